@@ -0,0 +1,346 @@
+"""
+Benchmarks the per-operation cost of the hot binding paths.
+
+Run in game using `pyexec path/to/benchmark/bench.py`. See the readme for details.
+"""
+
+import json
+import timeit
+from pathlib import Path
+from typing import TYPE_CHECKING, Any
+
+import unrealsdk
+from unrealsdk.hooks import Type, add_hook, remove_hook
+from unrealsdk.unreal import (
+    BoundFunction,
+    UObject,
+    UScriptStruct,
+    WrappedStruct,
+    ZArrayProperty,
+    ZFloatProperty,
+    ZIntProperty,
+    ZObjectProperty,
+    ZProperty,
+    ZStructProperty,
+)
+
+import pyunrealsdk
+
+if TYPE_CHECKING:
+    from collections.abc import Callable, Iterator
+
+# How many times to repeat each timing run, the best run is the one which gets reported
+REPEATS: int = 5
+# Default number of operations in each timing run - slower benchmarks override this
+ITERATIONS: int = 100_000
+
+# The functions we try call, as (class, function) pairs, bound to the class default object
+# These are all pure functions taking three ints, which exist in the core packages
+FUNCTION_CANDIDATES: tuple[tuple[str, str], ...] = (
+    ("Object", "Clamp"),
+    ("KismetMathLibrary", "Clamp"),
+)
+
+HOOK_IDENTIFIER: str = "pyunrealsdk_benchmark"
+
+PROP_FLAG_PARAM: int = 0x80
+PROP_FLAG_RETURN: int = 0x400
+
+type Results = dict[str, dict[str, float | int] | None]
+
+
+def time_stmt(stmt: str, namespace: dict[str, Any], iterations: int = ITERATIONS) -> float:
+    """
+    Times a statement.
+
+    Args:
+        stmt: The statement to time.
+        namespace: The globals to run the statement in.
+        iterations: How many times to run the statement per timing run.
+    Returns:
+        The best time, in ns per operation.
+    """
+    timer = timeit.Timer(stmt, globals=namespace)
+    best = min(timer.repeat(repeat=REPEATS, number=iterations))
+    return best * 1e9 / iterations
+
+
+def record(
+    results: Results,
+    name: str,
+    stmt: str,
+    namespace: dict[str, Any],
+    iterations: int = ITERATIONS,
+) -> None:
+    """
+    Times a statement, and records it in the results dict.
+
+    Args:
+        results: The results dict to record in.
+        name: The benchmark name.
+        stmt: The statement to time.
+        namespace: The globals to run the statement in.
+        iterations: How many times to run the statement per timing run.
+    """
+    ns_per_op = time_stmt(stmt, namespace, iterations)
+    results[name] = {"ns_per_op": round(ns_per_op, 2), "iterations": iterations}
+    print(f"{name:<40} {ns_per_op:>12.1f} ns/op")  # noqa: T201
+
+
+def find_engine() -> UObject | None:
+    """
+    Finds the engine object.
+
+    Returns:
+        The engine object, or None if it couldn't be found.
+    """
+    for obj in unrealsdk.find_all("Engine", exact=False):
+        if not obj.Name.startswith("Default__"):
+            return obj
+    return None
+
+
+def find_scalar_props(obj: UObject) -> dict[str, ZProperty]:
+    """
+    Finds a property of each benchmarked type on the given object.
+
+    Args:
+        obj: The object to search.
+    Returns:
+        A dict mapping the type name to the property.
+    """
+    wanted: dict[str, type[ZProperty]] = {
+        "int": ZIntProperty,
+        "float": ZFloatProperty,
+        "object": ZObjectProperty,
+        "struct": ZStructProperty,
+    }
+    found: dict[str, ZProperty] = {}
+    for prop in obj.Class._properties():
+        if prop.ArrayDim != 1:
+            continue
+        for name, prop_type in wanted.items():
+            # Want exact matches, subclasses may use different storage
+            if name not in found and type(prop) is prop_type:
+                found[name] = prop
+    return found
+
+
+def find_function() -> BoundFunction | None:
+    """
+    Finds the function to benchmark calls on.
+
+    Returns:
+        The bound function, or None if none of the candidates exist.
+    """
+    for cls_name, func_name in FUNCTION_CANDIDATES:
+        try:
+            cdo = unrealsdk.find_class(cls_name).ClassDefaultObject
+            func = getattr(cdo, func_name)
+        except ValueError, AttributeError:
+            continue
+        if isinstance(func, BoundFunction):
+            return func
+    return None
+
+
+def iter_int_arrays() -> Iterator[tuple[UScriptStruct, ZArrayProperty]]:
+    """
+    Iterates through all struct properties which are arrays of ints.
+
+    Yields:
+        Tuples of the struct, and the array property on it.
+    """
+    for struct in unrealsdk.find_all("ScriptStruct", exact=False):
+        assert isinstance(struct, UScriptStruct)
+        for prop in struct._properties():
+            if isinstance(prop, ZArrayProperty) and type(prop.Inner) is ZIntProperty:
+                yield struct, prop
+
+
+def bench_property_access(results: Results) -> None:
+    """
+    Benchmarks UObject attribute access.
+
+    Args:
+        results: The results dict to record in.
+    """
+    engine = find_engine()
+    if engine is None:
+        return
+
+    for type_name, prop in find_scalar_props(engine).items():
+        ns = {"obj": engine, "prop": prop, "name": prop.Name, "value": engine._get_field(prop)}
+        record(results, f"uobject.getattr.{type_name}", "getattr(obj, name)", ns)
+        record(results, f"uobject._get_field.{type_name}", "obj._get_field(prop)", ns)
+        record(results, f"uobject.setattr.{type_name}", "setattr(obj, name, value)", ns)
+        record(results, f"uobject._set_field.{type_name}", "obj._set_field(prop, value)", ns)
+
+    ns = {"obj": engine}
+    record(results, "uobject.hasattr.miss", "hasattr(obj, 'pyunrealsdk_benchmark_missing')", ns)
+
+
+def bench_function_calls(results: Results) -> None:
+    """
+    Benchmarks BoundFunction calls, and hooks on them.
+
+    Args:
+        results: The results dict to record in.
+    """
+    func = find_function()
+    if func is None:
+        return
+
+    param_names = [
+        prop.Name
+        for prop in func.func._properties()
+        if (prop.PropertyFlags & PROP_FLAG_PARAM) and not (prop.PropertyFlags & PROP_FLAG_RETURN)
+    ]
+    ns: dict[str, Any] = {
+        "func": func,
+        "kwargs": dict(zip(param_names, (5, 0, 10), strict=True)),
+        "params": WrappedStruct(func.func, 5, 0, 10),
+    }
+    record(results, "bound_function.call.positional", "func(5, 0, 10)", ns)
+    record(results, "bound_function.call.keyword", "func(**kwargs)", ns)
+    record(results, "bound_function.call.struct", "func(params)", ns)
+
+    # Prepared calls reuse their params struct, so also check that each call still gives the same
+    # result as a direct one, no matter what the previous call was
+    prepared = func.prepare(**dict(zip(param_names[1:], (0, 10), strict=True)))
+    for value in (5, 20, -5, 5):
+        if (got := prepared(value)) != (expected := func(value, 0, 10)):
+            raise RuntimeError(
+                f"prepared call on {value} returned {got}, but a direct call returned {expected}",
+            )
+    ns["prepared"] = prepared
+    record(results, "bound_function.call.prepared", "prepared(5)", ns)
+
+    def noop_hook(*_: Any) -> None:
+        pass
+
+    hooked_func = func.func._path_name()
+    add_hook(hooked_func, Type.PRE, HOOK_IDENTIFIER, noop_hook)
+    try:
+        record(results, "hooks.dispatch.pre", "func(params)", ns)
+    finally:
+        remove_hook(hooked_func, Type.PRE, HOOK_IDENTIFIER)
+
+    base = results["bound_function.call.struct"]
+    hooked = results["hooks.dispatch.pre"]
+    if base is not None and hooked is not None:
+        results["hooks.dispatch.pre.overhead"] = {
+            "ns_per_op": round(hooked["ns_per_op"] - base["ns_per_op"], 2),
+            "iterations": hooked["iterations"],
+        }
+
+
+def bench_arrays(results: Results) -> None:
+    """
+    Benchmarks WrappedArray operations.
+
+    Args:
+        results: The results dict to record in.
+    """
+    target = next(iter_int_arrays(), None)
+    if target is None:
+        return
+    struct_type, prop = target
+
+    size = 1000
+    # Each struct owns it's own array, so we can freely modify it
+    arr = getattr(WrappedStruct(struct_type), prop.Name)
+    arr.extend(range(size))
+
+    ns: dict[str, Any] = {
+        "arr": arr,
+        "values": list(range(size)),
+        "reversed_values": list(range(size, 0, -1)),
+        "make_array": lambda: getattr(WrappedStruct(struct_type), prop.Name),
+    }
+    record(results, "wrapped_array.getitem", "arr[500]", ns)
+    record(results, "wrapped_array.iter", "for _ in arr: pass", ns, iterations=1000)
+    record(results, "wrapped_array.extend", "make_array().extend(values)", ns, iterations=1000)
+    record(results, "wrapped_array.slice_assign", "arr[:] = values", ns, iterations=1000)
+    record(
+        results,
+        "wrapped_array.sort",
+        "arr[:] = reversed_values; arr.sort()",
+        ns,
+        iterations=1000,
+    )
+
+
+def bench_structs_and_find(results: Results) -> None:
+    """
+    Benchmarks struct creation and object searches.
+
+    Args:
+        results: The results dict to record in.
+    """
+    ns: dict[str, Any] = {"unrealsdk": unrealsdk}
+    record(results, "make_struct", "unrealsdk.make_struct('Vector', X=1, Y=2, Z=3)", ns)
+    record(results, "find_all.exact", "unrealsdk.find_all('Class')", ns, iterations=10)
+    record(results, "find_all.subclasses", "unrealsdk.find_all('Field', False)", ns, iterations=10)
+
+
+BENCHMARKS: tuple[tuple[tuple[str, ...], Callable[[Results], None]], ...] = (
+    (
+        (
+            "uobject.getattr.int",
+            "uobject._get_field.int",
+            "uobject.setattr.int",
+            "uobject._set_field.int",
+            "uobject.hasattr.miss",
+        ),
+        bench_property_access,
+    ),
+    (
+        (
+            "bound_function.call.positional",
+            "bound_function.call.keyword",
+            "bound_function.call.struct",
+            "bound_function.call.prepared",
+            "hooks.dispatch.pre",
+        ),
+        bench_function_calls,
+    ),
+    (
+        (
+            "wrapped_array.getitem",
+            "wrapped_array.iter",
+            "wrapped_array.extend",
+            "wrapped_array.slice_assign",
+            "wrapped_array.sort",
+        ),
+        bench_arrays,
+    ),
+    (("make_struct", "find_all.exact", "find_all.subclasses"), bench_structs_and_find),
+)
+
+
+def main() -> None:
+    """Runs all benchmarks, and writes the results file."""
+    results: Results = {}
+    for expected, bench in BENCHMARKS:
+        # Pre-fill everything as null, so skipped benchmarks still show up in the output
+        results |= dict.fromkeys(expected)
+        bench(results)
+
+    output = Path(__file__).with_name(
+        unrealsdk.config.get("pyunrealsdk", {}).get("benchmark_output", "bench_results.json"),
+    )
+    output.write_text(
+        json.dumps(
+            {
+                "pyunrealsdk": pyunrealsdk.__version__,
+                "unrealsdk": unrealsdk.__version__,
+                "results": results,
+            },
+            indent=2,
+        ),
+    )
+    print(f"Wrote benchmark results to {output}")  # noqa: T201
+
+
+main()
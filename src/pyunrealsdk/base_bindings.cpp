@@ -1,7 +1,9 @@
 #include "pyunrealsdk/pch.h"
 #include "pyunrealsdk/base_bindings.h"
+#include "pyunrealsdk/fname.h"
 #include "pyunrealsdk/logging.h"
 #include "pyunrealsdk/stubgen.h"
+#include "pyunrealsdk/unreal_bindings/compiled_path.h"
 #include "pyunrealsdk/unreal_bindings/uenum.h"
 #include "pyunrealsdk/unreal_bindings/wrapped_struct.h"
 #include "unrealsdk/config.h"
@@ -28,6 +30,9 @@ namespace {
 NamedObjectCache<UScriptStruct> scriptstruct_cache{};
 NamedObjectCache<UEnum> enum_cache{};
 
+// A name argument, which may be given either as a string or an FName object
+using NameArg = std::variant<PyFName, std::wstring>;
+
 /**
  * @brief Finds an object from a name cache, where the name might be fully qualified.
  * @note Throws if unable to find.
@@ -35,7 +40,7 @@ NamedObjectCache<UEnum> enum_cache{};
  * @tparam CachedType The type of the cached object.
  * @tparam StrGetterFunc The type of the string getter.
  * @tparam NameGetterFunc The type of the string getter.
- * @param name The name to lookup.
+ * @param name_arg The name to lookup. FName objects are always looked up as partial names.
  * @param fully_qualified If the name is fully qualified, or nullopt to autodetect.
  * @param error_type_name The type name to use in "couldn't find" errors.
  * @param str_getter The getter function to use on fully qualified names, called with a wstring.
@@ -43,11 +48,22 @@ NamedObjectCache<UEnum> enum_cache{};
  * @return The cached value, or it's default if unable to find.
  */
 template <typename CachedType, typename StrGetterFunc, typename NameGetterFunc>
-CachedType find_cached_potentially_qualified(const std::wstring& name,
+CachedType find_cached_potentially_qualified(const NameArg& name_arg,
                                              std::optional<bool> fully_qualified,
                                              const std::string& error_type_name,
                                              StrGetterFunc str_getter,
                                              NameGetterFunc fname_getter) {
+    if (std::holds_alternative<PyFName>(name_arg)) {
+        const auto& fname = std::get<PyFName>(name_arg).name;
+        auto val = fname_getter(fname);
+        if (val == nullptr) {
+            throw std::invalid_argument(
+                std::format("Couldn't find {} '{}'", error_type_name, fname));
+        }
+        return val;
+    }
+
+    const auto& name = std::get<std::wstring>(name_arg);
     if (!fully_qualified.has_value()) {
         fully_qualified = name.find_first_of(L".:") != std::string::npos;
     }
@@ -197,7 +213,7 @@ void register_base_bindings(py::module_& mod) {
 
     mod.def(
         PYUNREALSDK_STUBGEN_FUNC("find_class", "UClass"),
-        [](const std::wstring& name, std::optional<bool> fully_qualified) {
+        [](const NameArg& name, std::optional<bool> fully_qualified) {
             return find_cached_potentially_qualified<UClass*>(
                 name, fully_qualified, "class",
                 [](const std::wstring& name) { return unrealsdk::unreal::find_class(name); },
@@ -209,17 +225,17 @@ void register_base_bindings(py::module_& mod) {
             "Throws a ValueError if not found.\n"
             "\n"
             "Args:\n"
-            "    name: The class name.\n"
+            "    name: The class name. FName objects are never considered fully qualified.\n"
             "    fully_qualified: If the class name is fully qualified, or None (the default)\n"
             "                     to autodetect.\n"
             "Returns:\n"
             "    The unreal class.\n"),
-        PYUNREALSDK_STUBGEN_ARG("name"_a, "str", ),
+        PYUNREALSDK_STUBGEN_ARG("name"_a, "str | FName", ),
         PYUNREALSDK_STUBGEN_ARG("fully_qualified"_a, "bool | None", "None") = std::nullopt);
 
     mod.def(
         PYUNREALSDK_STUBGEN_FUNC("find_enum", "type[_GenericUnrealEnum]"),
-        [](const std::wstring& name, std::optional<bool> fully_qualified) {
+        [](const NameArg& name, std::optional<bool> fully_qualified) {
             auto enum_obj = find_cached_potentially_qualified<UEnum*>(
                 name, fully_qualified, "enum",
                 [](const std::wstring& name) { return enum_cache.find(name); },
@@ -233,18 +249,17 @@ void register_base_bindings(py::module_& mod) {
             "Throws a ValueError if not found.\n"
             "\n"
             "Args:\n"
-            "    name: The enum name.\n"
+            "    name: The enum name. FName objects are never considered fully qualified.\n"
             "    fully_qualified: If the enum name is fully qualified, or None (the default)\n"
             "                     to autodetect.\n"
             "Returns:\n"
             "    The unreal enum.\n"),
-        PYUNREALSDK_STUBGEN_ARG("name"_a, "str", ),
+        PYUNREALSDK_STUBGEN_ARG("name"_a, "str | FName", ),
         PYUNREALSDK_STUBGEN_ARG("fully_qualified"_a, "bool | None", "None") = std::nullopt);
 
     mod.def(
         PYUNREALSDK_STUBGEN_FUNC("make_struct", "WrappedStruct"),
-        [](const std::wstring& name, std::optional<bool> fully_qualified,
-           const py::kwargs& kwargs) {
+        [](const NameArg& name, std::optional<bool> fully_qualified, const py::kwargs& kwargs) {
             auto type = find_cached_potentially_qualified<UScriptStruct*>(
                 name, fully_qualified, "struct",
                 [](const std::wstring& name) { return scriptstruct_cache.find(name); },
@@ -257,13 +272,13 @@ void register_base_bindings(py::module_& mod) {
             "Finds and constructs a WrappedStruct by name.\n"
             "\n"
             "Args:\n"
-            "    name: The struct name.\n"
+            "    name: The struct name. FName objects are never considered fully qualified.\n"
             "    fully_qualified: If the struct name is fully qualified, or None (the\n"
             "                     default) to autodetect.\n"
             "    **kwargs: Fields on the struct to initialize.\n"
             "Returns:\n"
             "    The newly constructed struct.\n"),
-        PYUNREALSDK_STUBGEN_ARG("name"_a, "str", ),
+        PYUNREALSDK_STUBGEN_ARG("name"_a, "str | FName", ),
         PYUNREALSDK_STUBGEN_ARG("fully_qualified"_a, "bool | None", "None") = std::nullopt,
         PYUNREALSDK_STUBGEN_POS_ONLY());
     PYUNREALSDK_STUBGEN_ARG_N("**kwargs"_a, "Any", )
@@ -363,7 +378,7 @@ void register_base_bindings(py::module_& mod) {
             "    The constructed object.\n"),
         PYUNREALSDK_STUBGEN_ARG("cls"_a, "UClass | str", ),
         PYUNREALSDK_STUBGEN_ARG("outer"_a, "UObject | None", ),
-        PYUNREALSDK_STUBGEN_ARG("name"_a, "str", "\"None\"") = FName{},
+        PYUNREALSDK_STUBGEN_ARG("name"_a, "str | FName", "\"None\"") = FName{},
         PYUNREALSDK_STUBGEN_ARG("flags"_a, "int", "0") = 0,
         PYUNREALSDK_STUBGEN_ARG("template_obj"_a, "UObject | None", "None") = nullptr);
 
@@ -385,6 +400,27 @@ void register_base_bindings(py::module_& mod) {
         PYUNREALSDK_STUBGEN_ARG("name"_a, "str", ),
         PYUNREALSDK_STUBGEN_ARG("flags"_a, "int", "0") = 0);
 
+    mod.def(
+        PYUNREALSDK_STUBGEN_FUNC("compile_path", "CompiledPath"),
+        [](const std::variant<UClass*, std::wstring>& cls_arg, std::string_view path) {
+            return unreal::CompiledPath{evaluate_class_arg(cls_arg, std::nullopt), path};
+        },
+        PYUNREALSDK_STUBGEN_DOCSTRING(
+            "Compiles a chain of attribute accesses, so it can be quickly walked repeatedly.\n"
+            "\n"
+            "Throws a ValueError or AttributeError if the path is not valid on the class. All\n"
+            "fields except the last must be object or struct properties.\n"
+            "\n"
+            "Args:\n"
+            "    cls: The class the path starts from, or it's name. If given as the name,\n"
+            "         always autodetects if fully qualified - call find_class() directly if\n"
+            "         you need to specify.\n"
+            "    path: The path, as a dot separated list of attribute names.\n"
+            "Returns:\n"
+            "    The compiled path, which may be called with an object to walk it.\n"),
+        PYUNREALSDK_STUBGEN_ARG("cls"_a, "UClass | str", ),
+        PYUNREALSDK_STUBGEN_ARG("path"_a, "str", ));
+
     create_and_add_config_dict(mod);
 }
 
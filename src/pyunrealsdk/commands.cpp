@@ -4,6 +4,7 @@
 #include "pyunrealsdk/logging.h"
 #include "pyunrealsdk/static_py_object.h"
 #include "pyunrealsdk/stubgen.h"
+#include "pyunrealsdk/thread_state.h"
 #include "unrealsdk/commands.h"
 #include "unrealsdk/config.h"
 #include "unrealsdk/utils.h"
@@ -26,6 +27,7 @@ void pyexec_cmd_handler(const wchar_t* line, size_t size, size_t cmd_len) {
 
     try {
         const py::gil_scoped_acquire gil{};
+        keep_thread_state();
         const py::str py_path{
             PyUnicode_FromWideChar(path.c_str(), static_cast<py::ssize_t>(path.size()))};
 
@@ -92,6 +94,7 @@ void py_cmd_handler(const wchar_t* line, size_t size, size_t cmd_len) {
 
     try {
         const py::gil_scoped_acquire gil{};
+        keep_thread_state();
 
         const py::str code_block{
             PyUnicode_FromWideChar(str.c_str(), static_cast<py::ssize_t>(str.size()))};
@@ -116,6 +119,7 @@ void register_module(py::module_& mod) {
                 cmd, [static_callback](const wchar_t* line, size_t size, size_t cmd_len) {
                     try {
                         const py::gil_scoped_acquire gil{};
+                        keep_thread_state();
                         debug_this_thread();
 
                         const py::str py_line{
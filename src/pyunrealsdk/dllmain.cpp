@@ -2,7 +2,9 @@
 #include "pyunrealsdk/logging.h"
 #include "pyunrealsdk/pyunrealsdk.h"
 
-#ifdef PYUNREALSDK_INTERNAL
+// The dll entry point only exists on Windows - other builds need to call `pyunrealsdk::init()`
+// themselves
+#if defined(PYUNREALSDK_INTERNAL) && defined(_WIN32)
 
 namespace {
 
@@ -33,7 +33,13 @@ User code should never need to use these, they should always be hidden in implem
 #define PYUNREALSDK_MANGLE(name) _pyunrealsdk_export__##name
 
 // Determine the correct dllimport/export attribute
-#if defined(PYUNREALSDK_INTERNAL)
+#if !defined(_WIN32)
+
+// Outside of Windows there's no import/export distinction, we just need to make sure the symbol
+// stays visible from the shared library, even if building with hidden visibility by default
+#define PYUNREALSDK_DLLEXPORT [[gnu::visibility("default")]]
+
+#elif defined(PYUNREALSDK_INTERNAL)
 
 #if defined(__clang__) || defined(__MINGW32__)
 #define PYUNREALSDK_DLLEXPORT [[gnu::dllexport]]
@@ -53,7 +59,7 @@ User code should never need to use these, they should always be hidden in implem
 #error Unknown dllimport attribute
 #endif
 
-#endif  //  defined(PYUNREALSDK_INTERNAL)
+#endif  //  !defined(_WIN32)
 
 // Need extern C to create a valid export
 // Use the relevant dllimport/export attribute
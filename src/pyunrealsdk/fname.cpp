@@ -0,0 +1,93 @@
+#include "pyunrealsdk/pch.h"
+#include "pyunrealsdk/fname.h"
+#include "pyunrealsdk/stubgen.h"
+#include "unrealsdk/unreal/structs/fname.h"
+
+#ifdef PYUNREALSDK_INTERNAL
+
+using namespace unrealsdk::unreal;
+
+namespace pyunrealsdk {
+
+namespace {
+
+// Since the type is final, we can check for it with a simple pointer comparison
+PyTypeObject* fname_type = nullptr;
+
+}  // namespace
+
+const FName* get_py_fname(PyObject* obj) {
+    if (fname_type == nullptr || Py_TYPE(obj) != fname_type) {
+        return nullptr;
+    }
+
+    auto v_h = reinterpret_cast<py::detail::instance*>(obj)->get_value_and_holder();
+    return &static_cast<PyFName*>(v_h.value_ptr())->name;
+}
+
+void register_fname(py::module_& mod) {
+    PYUNREALSDK_STUBGEN_MODULE_N("unrealsdk")
+
+    py::classh<PyFName>(
+        mod, PYUNREALSDK_STUBGEN_CLASS("FName", ), py::is_final(),
+        PYUNREALSDK_STUBGEN_DOCSTRING(
+            "A handle to an unreal name.\n"
+            "\n"
+            "These may be passed anywhere which expects a name, and skip converting from\n"
+            "a string, so may be pre-built by performance critical code. They are hashable,\n"
+            "and compare equal to other FNames holding the same name - but not to strings.\n"))
+        .def(PYUNREALSDK_STUBGEN_METHOD_N("__init__", "None")
+                 py::init([](const FName& name) { return PyFName{name}; }),
+             PYUNREALSDK_STUBGEN_DOCSTRING("Creates a new FName.\n"
+                                           "\n"
+                                           "Args:\n"
+                                           "    name: The name to hold.\n"),
+             PYUNREALSDK_STUBGEN_ARG("name"_a, "str | FName", ))
+        .def(
+            PYUNREALSDK_STUBGEN_METHOD("__repr__", "str"),
+            [](const PyFName& self) { return std::format("FName('{}')", self.name); },
+            PYUNREALSDK_STUBGEN_DOCSTRING("Gets a string representation of this name.\n"
+                                          "\n"
+                                          "Returns:\n"
+                                          "    The string representation.\n"))
+        .def(
+            PYUNREALSDK_STUBGEN_METHOD("__str__", "str"),
+            [](const PyFName& self) { return self.name; },
+            PYUNREALSDK_STUBGEN_DOCSTRING("Gets the string this name holds.\n"
+                                          "\n"
+                                          "Returns:\n"
+                                          "    The name, as a string.\n"))
+        // Must be defined before __eq__, or pybind will set it to None
+        .def(
+            PYUNREALSDK_STUBGEN_METHOD("__hash__", "int"),
+            [](const PyFName& self) {
+                return static_cast<py::ssize_t>(std::hash<FName>{}(self.name));
+            },
+            PYUNREALSDK_STUBGEN_DOCSTRING("Gets the hash of this name.\n"
+                                          "\n"
+                                          "Returns:\n"
+                                          "    The hash.\n"))
+        .def(
+            PYUNREALSDK_STUBGEN_METHOD("__eq__", "bool"),
+            [](const PyFName& self, const py::object& other) -> py::object {
+                auto other_name = get_py_fname(other.ptr());
+                if (other_name == nullptr) {
+                    return py::reinterpret_borrow<py::object>(Py_NotImplemented);
+                }
+                return py::bool_(self.name == *other_name);
+            },
+            PYUNREALSDK_STUBGEN_DOCSTRING("Checks if this name is the same as another.\n"
+                                          "\n"
+                                          "Args:\n"
+                                          "    other: The other object to compare against.\n"
+                                          "Returns:\n"
+                                          "    True if both objects are the same name.\n"),
+            PYUNREALSDK_STUBGEN_ARG("other"_a, "object", ));
+
+    // The module keeps a reference to the type, so it's safe to hold onto the raw pointer
+    fname_type = reinterpret_cast<PyTypeObject*>(mod.attr("FName").ptr());
+}
+
+}  // namespace pyunrealsdk
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef PYUNREALSDK_FNAME_H
+#define PYUNREALSDK_FNAME_H
+
+#include "pyunrealsdk/pch.h"
+#include "unrealsdk/unreal/structs/fname.h"
+
+#ifdef PYUNREALSDK_INTERNAL
+
+namespace pyunrealsdk {
+
+// Python wrapper around an FName, which may be passed anywhere a name is expected without needing
+// any conversion. We can't bind FName directly, since it has a custom caster to/from strings.
+struct PyFName {
+    unrealsdk::unreal::FName name;
+};
+
+/**
+ * @brief Registers the FName type.
+ *
+ * @param mod The module to register within.
+ */
+void register_fname(py::module_& mod);
+
+/**
+ * @brief Gets the name held by a python FName object.
+ *
+ * @param obj The python object.
+ * @return A pointer to the contained name, or nullptr if the object isn't an FName.
+ */
+const unrealsdk::unreal::FName* get_py_fname(PyObject* obj);
+
+}  // namespace pyunrealsdk
+
+#endif
+
+#endif /* PYUNREALSDK_FNAME_H */
@@ -1,15 +1,22 @@
 #include "pyunrealsdk/pch.h"
 #include "pyunrealsdk/debugging.h"
 #include "pyunrealsdk/exports.h"
+#include "pyunrealsdk/hook_action.h"
+#include "pyunrealsdk/hook_filter.h"
 #include "pyunrealsdk/hooks.h"
 #include "pyunrealsdk/logging.h"
 #include "pyunrealsdk/static_py_object.h"
 #include "pyunrealsdk/stubgen.h"
+#include "pyunrealsdk/thread_state.h"
 #include "pyunrealsdk/unreal_bindings/property_access.h"
 #include "unrealsdk/hook_manager.h"
 #include "unrealsdk/unreal/cast.h"
+#include "unrealsdk/unreal/classes/ufunction.h"
+#include "unrealsdk/unreal/find_class.h"
 #include "unrealsdk/unreal/prop_traits.h"
 #include "unrealsdk/unreal/wrappers/property_proxy.h"
+#include "unrealsdk/unrealsdk.h"
+#include "unrealsdk/utils.h"
 
 using namespace unrealsdk::unreal;
 using namespace unrealsdk::hook_manager;
@@ -26,38 +33,141 @@ namespace {
 struct Block {};
 struct Unset {};
 
+// A view of a hook's return value, which is only converted when accessed.
+struct LazyReturn {
+    // Cleared once the hooks finish running, since the details are gone by then
+    Details* hook = nullptr;
+};
+
 // And we need an empty dummy class to create the context manager on.
 struct AutoInjectContextManager {};
 
 thread_local size_t auto_inject_count = 0;
 
+// How many python hooks the current thread is nested inside
+thread_local size_t hook_depth = 0;
+
+// Marks the current thread as being inside a hook for it's lifetime.
+struct HookDepthGuard {
+    HookDepthGuard(void) { hook_depth++; }
+    ~HookDepthGuard() { hook_depth--; }
+
+    HookDepthGuard(const HookDepthGuard&) = delete;
+    HookDepthGuard(HookDepthGuard&&) = delete;
+    HookDepthGuard& operator=(const HookDepthGuard&) = delete;
+    HookDepthGuard& operator=(HookDepthGuard&&) = delete;
+};
+
 }  // namespace
 
 bool should_auto_inject_py_calls(void) {
     return auto_inject_count > 0;
 }
 
+bool is_in_hook(void) {
+    return hook_depth > 0;
+}
+
 namespace {
 
+// The python objects passed to a hook callback
+struct PyHookArgs {
+    py::object obj;
+    // This is a reference to the args struct, fields are only converted when accessed
+    py::object args;
+    // These are both created on first use, since many hooks never need them
+    py::object ret;
+    py::object lazy_ret;
+    py::object func;
+
+    PyHookArgs(void) = default;
+    PyHookArgs(const PyHookArgs&) = delete;
+    PyHookArgs(PyHookArgs&&) = delete;
+    PyHookArgs& operator=(const PyHookArgs&) = delete;
+    PyHookArgs& operator=(PyHookArgs&&) = delete;
+
+    ~PyHookArgs() {
+        // Python may have kept a reference to the lazy return, make sure it can't access the
+        // details after they're gone
+        if (this->lazy_ret) {
+            py::cast<LazyReturn&>(this->lazy_ret).hook = nullptr;
+        }
+    }
+};
+
+/**
+ * @brief Converts the hook details into python objects.
+ *
+ * @param hook The hook details.
+ * @param args The python hook args to fill.
+ */
+void make_py_hook_args(Details& hook, PyHookArgs& args) {
+    constexpr auto policy = py::return_value_policy::automatic_reference;
+
+    args.obj = py::cast(hook.obj, policy);
+    args.args = py::cast(hook.args, policy);
+    args.func = py::cast(hook.func, policy);
+}
+
+/**
+ * @brief Converts a hook's current return value into python.
+ *
+ * @param hook The hook details.
+ * @return The return value, or the Unset type if it's not set.
+ */
+py::object py_hook_ret(Details& hook) {
+    if (!hook.ret.has_value()) {
+        return py::type::of<Unset>();
+    }
+
+    py::object ret;
+    cast(hook.ret.prop, [&hook, &ret]<typename T>(T* prop) {
+        ret = pyunrealsdk::unreal::py_getattr(
+            prop, reinterpret_cast<uintptr_t>(hook.ret.ptr.get()), hook.ret.ptr);
+    });
+    return ret;
+}
+
+/**
+ * @brief Gets the ret arg to pass to a hook callback.
+ *
+ * @param hook The hook details.
+ * @param args The python hook args.
+ * @param lazy True if the callback wants a lazy return value.
+ * @return The ret arg.
+ */
+const py::object& get_py_hook_ret(Details& hook, PyHookArgs& args, bool lazy) {
+    if (lazy) {
+        if (!args.lazy_ret) {
+            args.lazy_ret = py::cast(LazyReturn{.hook = &hook});
+        }
+        return args.lazy_ret;
+    }
+
+    if (!args.ret) {
+        args.ret = py_hook_ret(hook);
+    }
+    return args.ret;
+}
+
 /**
  * @brief Handles calling a python hook.
  *
  * @param hook The hook details.
+ * @param args The python hook args. If the hook overwrites the return value, the ret arg is
+ *             updated to match, ready to pass to the next hook.
  * @param callback The python hook callback.
+ * @param lazy_ret True if the callback wants a lazy return value.
+ * @param overrode_ret Set to true if the hook overwrote the return value.
  * @return True if to block the function call.
  */
-bool handle_py_hook(Details& hook, const py::object& callback) {
-    py::object ret_arg;
-    if (hook.ret.has_value()) {
-        cast(hook.ret.prop, [&hook, &ret_arg]<typename T>(T* prop) {
-            ret_arg = pyunrealsdk::unreal::py_getattr(
-                prop, reinterpret_cast<uintptr_t>(hook.ret.ptr.get()), hook.ret.ptr);
-        });
-    } else {
-        ret_arg = py::type::of<Unset>();
-    }
-
-    auto py_ret = callback(hook.obj, hook.args, ret_arg, hook.func);
+bool handle_py_hook(Details& hook,
+                    PyHookArgs& args,
+                    const py::object& callback,
+                    bool lazy_ret,
+                    bool& overrode_ret) {
+    auto py_ret =
+        callback(args.obj, args.args, get_py_hook_ret(hook, args, lazy_ret), args.func);
 
     if (!py::isinstance<py::tuple>(py_ret)) {
         // If not a tuple, the value we got is always the first field, if to block
@@ -79,10 +189,11 @@ bool handle_py_hook(Details& hook, const py::object& callback) {
         return should_block;
     }
 
-    auto ret_override = ret_tuple[1];
+    py::object ret_override = ret_tuple[1];
     if (py::type::of<Unset>().is(ret_override) || py::isinstance<Unset>(ret_override)) {
         // If unset, destroy whatever was there before
         hook.ret.destroy();
+        args.ret = py::type::of<Unset>();
     } else if (py::ellipsis{}.equal(ret_override)) {
         // If ellipsis, keep whatever there was before - intentionally empty
     } else if (hook.ret.prop == nullptr) {
@@ -103,6 +214,9 @@ bool handle_py_hook(Details& hook, const py::object& callback) {
             pyunrealsdk::unreal::py_setattr_direct(
                 prop, reinterpret_cast<uintptr_t>(hook.ret.ptr.get()), ret_override);
         });
+        // Pass the override straight on to the next hook, rather than reading it back again
+        args.ret = std::move(ret_override);
+        overrode_ret = true;
     }
     if (size < 3) {
         return should_block;
@@ -116,6 +230,429 @@ bool handle_py_hook(Details& hook, const py::object& callback) {
     return should_block;
 }
 
+// The identifier we use for the unrealsdk hook which dispatches all python hooks in a group
+const constexpr auto COALESCED_HOOK_IDENTIFIER = L"pyunrealsdk_coalesced_hooks";
+
+// Define this to stop recording hook stats, removing the clock reads from the hot path
+#ifdef PYUNREALSDK_DISABLE_HOOK_STATS
+const constexpr bool HOOK_STATS_ENABLED = false;
+#else
+const constexpr bool HOOK_STATS_ENABLED = true;
+#endif
+
+using HookClock = std::chrono::steady_clock;
+static_assert(std::atomic<HookClock::rep>::is_always_lock_free);
+
+// Performance counters for a single python hook.
+struct PyHookStats {
+    uint64_t calls = 0;
+    uint64_t exceptions = 0;
+    uint64_t blocks = 0;
+    uint64_t overrides = 0;
+    // Includes the time spent waiting on the GIL
+    HookClock::duration total_time{};
+    HookClock::duration max_time{};
+    HookClock::duration gil_wait_time{};
+};
+
+struct PyHookEntry {
+    std::wstring identifier;
+    StaticPyObject callback;
+    // All of these must match for the callback to run
+    BoundHookFilters filters;
+    // If to pass the callback a LazyReturn, rather than the converted return value
+    bool lazy_ret = false;
+    // Only run on every nth call which passes the filters
+    uint64_t every_n = 1;
+    // The minimum time between runs
+    HookClock::duration min_interval{};
+
+    // Entries are otherwise immutable, these are only modified while holding the GIL
+    mutable PyHookStats stats{};
+
+    // These are updated before grabbing the GIL, so need to be atomic
+    mutable std::atomic<uint64_t> sample_count = 0;
+    mutable std::atomic<HookClock::rep> next_run_time = 0;
+
+    /**
+     * @brief Checks if this hook should run, based on it's filters.
+     * @note Does not require the GIL.
+     *
+     * @param hook The hook details.
+     * @return True if the callback should run.
+     */
+    [[nodiscard]] bool should_run(const Details& hook) const {
+        if (!std::ranges::all_of(this->filters,
+                                 [&hook](const auto& filter) { return filter->matches(hook); })) {
+            return false;
+        }
+
+        if (this->every_n > 1
+            && this->sample_count.fetch_add(1, std::memory_order_relaxed) % this->every_n != 0) {
+            return false;
+        }
+
+        if (this->min_interval > HookClock::duration::zero()) {
+            auto now = HookClock::now().time_since_epoch().count();
+            auto next_run = this->next_run_time.load(std::memory_order_relaxed);
+            if (now < next_run) {
+                return false;
+            }
+            // Saturate, rather than overflowing on very long intervals
+            auto interval = this->min_interval.count();
+            auto new_next_run = now > std::numeric_limits<HookClock::rep>::max() - interval
+                                    ? std::numeric_limits<HookClock::rep>::max()
+                                    : now + interval;
+            // If another thread got here first, it gets to run this interval instead
+            return this->next_run_time.compare_exchange_strong(next_run, new_next_run,
+                                                               std::memory_order_relaxed);
+        }
+
+        return true;
+    }
+};
+
+// All the python hooks on a single function and type, which get run from a single unrealsdk hook.
+class PyHookGroup {
+   public:
+    using Entries = std::vector<std::shared_ptr<const PyHookEntry>>;
+
+   private:
+    // Hooks may be added or removed while we're running them, so we always run off of a snapshot.
+    // This is protected by it's own mutex rather than the GIL, so that we can skip grabbing the GIL
+    // if there's nothing to run.
+    std::mutex mutex;
+    std::shared_ptr<const Entries> entries = std::make_shared<const Entries>();
+
+   public:
+    /**
+     * @brief Gets a snapshot of the current hooks in this group.
+     *
+     * @return The hooks.
+     */
+    std::shared_ptr<const Entries> snapshot(void) {
+        const std::lock_guard<std::mutex> lock{this->mutex};
+        return this->entries;
+    }
+
+    /**
+     * @brief Checks if this group contains a hook with the given identifier.
+     *
+     * @param identifier The identifier to check.
+     * @return True if a hook with the identifier exists.
+     */
+    bool contains(std::wstring_view identifier) {
+        auto current = this->snapshot();
+        return std::ranges::any_of(
+            *current, [identifier](const auto& entry) { return entry->identifier == identifier; });
+    }
+
+    /**
+     * @brief Adds a new hook to this group.
+     *
+     * @param entry The hook to add.
+     */
+    void add(std::shared_ptr<const PyHookEntry>&& entry) {
+        const std::lock_guard<std::mutex> lock{this->mutex};
+        auto updated = std::make_shared<Entries>(*this->entries);
+        updated->push_back(std::move(entry));
+        this->entries = std::move(updated);
+    }
+
+    /**
+     * @brief Removes a hook from this group.
+     *
+     * @param identifier The identifier of the hook to remove.
+     * @return True if a hook was removed.
+     */
+    bool remove(std::wstring_view identifier) {
+        const std::lock_guard<std::mutex> lock{this->mutex};
+        auto updated = std::make_shared<Entries>(*this->entries);
+        auto removed = std::erase_if(
+            *updated, [identifier](const auto& entry) { return entry->identifier == identifier; });
+        if (removed == 0) {
+            return false;
+        }
+        this->entries = std::move(updated);
+        return true;
+    }
+
+    /**
+     * @brief Checks if this group is empty.
+     *
+     * @return True if there are no hooks in this group.
+     */
+    bool empty(void) { return this->snapshot()->empty(); }
+};
+
+// Only ever accessed while holding the GIL, the groups themselves handle their own locking
+std::map<std::pair<std::wstring, Type>, std::shared_ptr<PyHookGroup>> py_hook_groups{};
+
+/**
+ * @brief Runs all the python hooks in a group.
+ *
+ * @param hook The hook details.
+ * @param group The group of hooks to run.
+ * @return True if any hook requested to block the function call.
+ */
+bool dispatch_py_hooks(Details& hook, PyHookGroup& group) {
+    auto entries = group.snapshot();
+    if (entries->empty()) {
+        return false;
+    }
+
+    try {
+        // Filters are checked natively, so only grab the GIL once we find a hook which must run
+        std::optional<py::gil_scoped_acquire> gil{};
+        std::optional<HookDepthGuard> depth{};
+        std::optional<PyHookArgs> args{};
+
+        bool should_block = false;
+        for (const auto& entry : *entries) {
+            if (!entry->should_run(hook)) {
+                continue;
+            }
+
+            HookClock::time_point start{};
+            if constexpr (HOOK_STATS_ENABLED) {
+                start = HookClock::now();
+            }
+
+            if (!gil.has_value()) {
+                gil.emplace();
+                if constexpr (HOOK_STATS_ENABLED) {
+                    entry->stats.gil_wait_time += HookClock::now() - start;
+                }
+
+                keep_thread_state();
+                debug_this_thread();
+                depth.emplace();
+            }
+
+            try {
+                if (!args.has_value()) {
+                    make_py_hook_args(hook, args.emplace());
+                }
+                bool overrode_ret = false;
+                const bool blocked = handle_py_hook(hook, *args, entry->callback.obj(),
+                                                    entry->lazy_ret, overrode_ret);
+                if (blocked) {
+                    should_block = true;
+                }
+
+                if constexpr (HOOK_STATS_ENABLED) {
+                    entry->stats.blocks += blocked ? 1 : 0;
+                    entry->stats.overrides += overrode_ret ? 1 : 0;
+                }
+            } catch (const std::exception& ex) {
+                if constexpr (HOOK_STATS_ENABLED) {
+                    entry->stats.exceptions++;
+                }
+                logging::log_python_exception(ex);
+            }
+
+            if constexpr (HOOK_STATS_ENABLED) {
+                auto elapsed = HookClock::now() - start;
+                entry->stats.calls++;
+                entry->stats.total_time += elapsed;
+                entry->stats.max_time = std::max(entry->stats.max_time, elapsed);
+            }
+        }
+
+        return should_block;
+    } catch (const std::exception& ex) {
+        logging::log_python_exception(ex);
+        return false;
+    }
+}
+
+/**
+ * @brief Adds a python hook.
+ *
+ * @param func The function to hook.
+ * @param type Which type of hook to add.
+ * @param identifier The hook identifier.
+ * @param callback The python callback.
+ * @param filter The python filter arg.
+ * @param lazy_ret If to pass the callback a LazyReturn, rather than the converted return value.
+ * @param every_n Only run the callback on every nth call.
+ * @param min_interval_ms The minimum time between runs of the callback, in milliseconds.
+ * @return True if successfully added, false if an identical hook already existed, or if the hook
+ *         couldn't be registered.
+ */
+bool add_py_hook(const std::wstring& func,
+                 Type type,
+                 const std::wstring& identifier,
+                 const py::object& callback,
+                 const py::object& filter,
+                 bool lazy_ret,
+                 int64_t every_n,
+                 double min_interval_ms) {
+    if (every_n < 1) {
+        throw py::value_error("every_n must be at least 1");
+    }
+    if (!std::isfinite(min_interval_ms) || min_interval_ms < 0) {
+        throw py::value_error("min_interval_ms must be a finite, non-negative number");
+    }
+    // Converting anything near the clock's max would overflow it's integer rep. Leave plenty of
+    // margin, so that rounding while converting can't push us over either - this is still over a
+    // century.
+    static const auto max_interval_ms =
+        std::chrono::duration<double, std::milli>{HookClock::duration::max()}.count() / 2;
+    if (min_interval_ms > max_interval_ms) {
+        throw py::value_error(std::format("min_interval_ms must be at most {}", max_interval_ms));
+    }
+    if (has_hook(func, type, identifier)) {
+        return false;
+    }
+
+    // Convert before we touch anything, so that an invalid filter doesn't leave a dangling group
+    auto filters = filters_from_py(filter);
+
+    auto key = std::make_pair(func, type);
+    auto iter = py_hook_groups.find(key);
+    if (iter == py_hook_groups.end()) {
+        auto group = std::make_shared<PyHookGroup>();
+        // This may fail if the dispatcher is already registered under a different spelling of the
+        // function's name. Only track the group once we know it'll actually get run.
+        if (!add_hook(func, type, COALESCED_HOOK_IDENTIFIER,
+                      [group](Details& hook) { return dispatch_py_hooks(hook, *group); })) {
+            LOG(DEV_WARNING, "Failed to add hook on '{}', is it already hooked under another name?",
+                unrealsdk::utils::narrow(func));
+            return false;
+        }
+        iter = py_hook_groups.emplace(std::move(key), std::move(group)).first;
+    } else if (iter->second->contains(identifier)) {
+        return false;
+    }
+
+    auto entry = std::make_shared<PyHookEntry>();
+    entry->identifier = identifier;
+    // Convert to a static py object, so the hook can safely get destroyed whenever
+    entry->callback = StaticPyObject{callback};
+    // Filters resolve against the function on the first call, so it doesn't need to be loaded yet
+    entry->filters = bind_filters(filters, nullptr);
+    entry->lazy_ret = lazy_ret;
+    entry->every_n = static_cast<uint64_t>(every_n);
+    entry->min_interval = std::chrono::duration_cast<HookClock::duration>(
+        std::chrono::duration<double, std::milli>{min_interval_ms});
+
+    iter->second->add(std::move(entry));
+    return true;
+}
+
+/**
+ * @brief Checks if a hook exists, either one of ours or one added directly through unrealsdk.
+ *
+ * @param func The function to check.
+ * @param type The type of hook to check.
+ * @param identifier The hook identifier.
+ * @return True if a hook with the given details exists.
+ */
+bool has_py_hook(const std::wstring& func, Type type, const std::wstring& identifier) {
+    auto iter = py_hook_groups.find(std::make_pair(func, type));
+    if (iter != py_hook_groups.end() && iter->second->contains(identifier)) {
+        return true;
+    }
+    return identifier != COALESCED_HOOK_IDENTIFIER && has_hook(func, type, identifier);
+}
+
+/**
+ * @brief Removes a hook, either one of ours or one added directly through unrealsdk.
+ *
+ * @param func The function to remove hooks from.
+ * @param type The type of hook to remove.
+ * @param identifier The hook identifier.
+ * @return True if successfully removed, false if no hook with the given details exists.
+ */
+bool remove_py_hook(const std::wstring& func, Type type, const std::wstring& identifier) {
+    auto iter = py_hook_groups.find(std::make_pair(func, type));
+    if (iter != py_hook_groups.end() && iter->second->remove(identifier)) {
+        if (iter->second->empty()) {
+            remove_hook(func, type, COALESCED_HOOK_IDENTIFIER);
+            py_hook_groups.erase(iter);
+        }
+        return true;
+    }
+    return identifier != COALESCED_HOOK_IDENTIFIER && remove_hook(func, type, identifier);
+}
+
+/**
+ * @brief Adds a native hook, which runs a set of static actions without entering python.
+ *
+ * @param func The function to hook.
+ * @param type Which type of hook to add.
+ * @param identifier The hook identifier.
+ * @param action The python action arg.
+ * @param filter The python filter arg.
+ * @return True if successfully added, false if an identical hook already existed.
+ */
+bool add_native_hook(const std::wstring& func,
+                     Type type,
+                     const std::wstring& identifier,
+                     const py::object& action,
+                     const py::object& filter) {
+    if (has_py_hook(func, type, identifier)) {
+        return false;
+    }
+
+    // The function doesn't need to be loaded yet. If it is, compile everything upfront, so that
+    // any errors get thrown now, and the hook itself doesn't need to touch python.
+    auto* ufunc = static_cast<UFunction*>(unrealsdk::find_object(find_class<UFunction>(), func));
+    auto actions = std::make_shared<const NativeHookActions>(actions_from_py(action), ufunc);
+    auto filters =
+        std::make_shared<const BoundHookFilters>(bind_filters(filters_from_py(filter), ufunc));
+
+    return add_hook(func, type, identifier, [actions, filters](Details& hook) {
+        if (!std::ranges::all_of(*filters,
+                                 [&hook](const auto& filter) { return filter->matches(hook); })) {
+            return false;
+        }
+        return actions->run(hook);
+    });
+}
+
+/**
+ * @brief Gets the stats of all python hooks.
+ *
+ * @return A dict mapping each hook's (func, type, identifier) to a dict of it's stats.
+ */
+py::dict get_py_hook_stats(void) {
+    auto to_seconds = [](HookClock::duration duration) {
+        return std::chrono::duration<double>(duration).count();
+    };
+
+    py::dict all_stats{};
+    for (const auto& [key, group] : py_hook_groups) {
+        for (const auto& entry : *group->snapshot()) {
+            const auto& stats = entry->stats;
+
+            py::dict entry_stats{};
+            entry_stats["calls"] = stats.calls;
+            entry_stats["total_time"] = to_seconds(stats.total_time);
+            entry_stats["max_time"] = to_seconds(stats.max_time);
+            entry_stats["gil_wait_time"] = to_seconds(stats.gil_wait_time);
+            entry_stats["exceptions"] = stats.exceptions;
+            entry_stats["blocks"] = stats.blocks;
+            entry_stats["overrides"] = stats.overrides;
+
+            all_stats[py::make_tuple(key.first, key.second, entry->identifier)] = entry_stats;
+        }
+    }
+    return all_stats;
+}
+
+/**
+ * @brief Resets the stats of all python hooks.
+ */
+void reset_py_hook_stats(void) {
+    for (const auto& [key, group] : py_hook_groups) {
+        for (const auto& entry : *group->snapshot()) {
+            entry->stats = {};
+        }
+    }
+}
+
 }  // namespace
 
 void register_module(py::module_& mod) {
@@ -133,6 +670,9 @@ void register_module(py::module_& mod) {
                    "Called after the hooked function, even if it got blocked."))
         .finalize();
 
+    register_hook_filter(hooks);
+    register_hook_action(hooks);
+
     py::classh<Block>(
         hooks, PYUNREALSDK_STUBGEN_CLASS("Block", ),
         PYUNREALSDK_STUBGEN_DOCSTRING(
@@ -147,6 +687,36 @@ void register_module(py::module_& mod) {
             "return value will be used.\n"))
         .def(py::init<>());
 
+    py::classh<LazyReturn>(
+        hooks, PYUNREALSDK_STUBGEN_CLASS("LazyReturn", ),
+        PYUNREALSDK_STUBGEN_DOCSTRING(
+            "A view of a hook's return value, which is only converted when accessed.\n"
+            "\n"
+            "Passed as the `ret` arg to hooks added with `lazy_ret=True`. Only valid while the\n"
+            "hooks on the function are running.\n"))
+        .def_property_readonly(
+            PYUNREALSDK_STUBGEN_ATTR("value", "Any"),
+            [](const LazyReturn& self) {
+                if (self.hook == nullptr) {
+                    throw std::runtime_error(
+                        "cannot access hook return value after the hook has finished");
+                }
+                return py_hook_ret(*self.hook);
+            },
+            PYUNREALSDK_STUBGEN_DOCSTRING(
+                "The current return value, or the previous override's value, if the function\n"
+                "has yet to run. The Unset type if neither is set.\n"))
+        .def_property_readonly(
+            PYUNREALSDK_STUBGEN_ATTR("is_set", "bool"),
+            [](const LazyReturn& self) {
+                if (self.hook == nullptr) {
+                    throw std::runtime_error(
+                        "cannot access hook return value after the hook has finished");
+                }
+                return self.hook->ret.has_value();
+            },
+            PYUNREALSDK_STUBGEN_DOCSTRING("True if there is currently a return value.\n"));
+
     // Create under an empty handle to prevent this type being normally accessible
     py::classh<AutoInjectContextManager>(py::handle(), "context_manager", pybind11::module_local())
         .def("__enter__", [](const py::object& /*self*/) { auto_inject_count++; })
@@ -198,23 +768,7 @@ void register_module(py::module_& mod) {
 
     hooks.def(
         PYUNREALSDK_STUBGEN_FUNC("add_hook", "bool"),
-        [](const std::wstring& func, Type type, const std::wstring& identifier,
-           const py::object& callback) {
-            // Convert to a static py object, so the lambda can safely get destroyed whenever
-            const StaticPyObject static_callback{callback};
-            return add_hook(func, type, identifier, [static_callback](Details& hook) {
-                try {
-                    const py::gil_scoped_acquire gil{};
-                    debug_this_thread();
-
-                    return handle_py_hook(hook, static_callback);
-
-                } catch (const std::exception& ex) {
-                    logging::log_python_exception(ex);
-                    return false;
-                }
-            });
-        },
+        &add_py_hook,
         PYUNREALSDK_STUBGEN_DOCSTRING(
             "Adds a hook which runs when an unreal function is called.\n"
             "\n"
@@ -249,36 +803,137 @@ void register_module(py::module_& mod) {
             "the function's already run, the effects are dropped. Overwriting the return\n"
             "value only serves to change what's passed in `ret` during any later hooks.\n"
             "\n"
+            "If `lazy_ret` is set, `ret` is instead a `LazyReturn`, which only converts the\n"
+            "return value if it's accessed. This is cheaper for hooks which rarely need it.\n"
+            "`args` is always a view of the hook's args struct, fields are only converted\n"
+            "when accessed.\n"
+            "\n"
+            "Hooks may be given filters, which restrict which calls they run on. Filters are\n"
+            "checked without entering python, so calls which don't pass them are much cheaper\n"
+            "than returning early from the callback.\n"
+            "\n"
+            "Hooks on frequently called functions may also be rate limited, using `every_n`\n"
+            "and `min_interval_ms`. These are also checked without entering python, after the\n"
+            "filters. Skipped calls behave as if the hook wasn't there.\n"
+            "\n"
             "Args:\n"
             "    func: The function to hook.\n"
             "    type: Which type of hook to add.\n"
             "    identifier: The hook identifier.\n"
             "    callback: The callback to run when the hooked function is called.\n"
+            "    filter: A filter, or sequence of filters, which must all pass for the callback\n"
+            "            to run.\n"
+            "    lazy_ret: If true, pass a LazyReturn as `ret`, rather than the value itself.\n"
+            "    every_n: Only run the callback on every nth call which passes the filters.\n"
+            "    min_interval_ms: The minimum time between runs of the callback, in\n"
+            "                     milliseconds.\n"
             "Returns:\n"
-            "    True if successfully added, false if an identical hook already existed.\n"),
+            "    True if successfully added, false if an identical hook already existed, or if\n"
+            "    the hook couldn't be registered.\n"),
         PYUNREALSDK_STUBGEN_ARG("func"_a, "str", ), PYUNREALSDK_STUBGEN_ARG("type"_a, "Type", ),
         PYUNREALSDK_STUBGEN_ARG("identifier"_a, "str", ),
-        PYUNREALSDK_STUBGEN_ARG("callback"_a, "_PreHookCallback | _PostHookCallback", ));
+        PYUNREALSDK_STUBGEN_ARG("callback"_a, "_PreHookCallback | _PostHookCallback", ),
+        PYUNREALSDK_STUBGEN_ARG("filter"_a, "HookFilter | Sequence[HookFilter] | None", "None") =
+            py::none{},
+        PYUNREALSDK_STUBGEN_KW_ONLY(),
+        PYUNREALSDK_STUBGEN_ARG("lazy_ret"_a, "bool", "False") = false,
+        PYUNREALSDK_STUBGEN_ARG("every_n"_a, "int", "1") = 1,
+        PYUNREALSDK_STUBGEN_ARG("min_interval_ms"_a, "float", "0") = 0.0);
 
     PYUNREALSDK_STUBGEN_OVERLOAD_N("add_hook", "bool")
     PYUNREALSDK_STUBGEN_ARG_N("func"_a, "str", )
     PYUNREALSDK_STUBGEN_ARG_N("type"_a, "_PreHookType", )
     PYUNREALSDK_STUBGEN_ARG_N("identifier"_a, "str", )
     PYUNREALSDK_STUBGEN_ARG_N("callback"_a, "_PreHookCallback", )
+    PYUNREALSDK_STUBGEN_ARG_N("filter"_a, "HookFilter | Sequence[HookFilter] | None", "None")
+    PYUNREALSDK_STUBGEN_KW_ONLY_N()
+    PYUNREALSDK_STUBGEN_ARG_N("lazy_ret"_a, "bool", "False")
+    PYUNREALSDK_STUBGEN_ARG_N("every_n"_a, "int", "1")
+    PYUNREALSDK_STUBGEN_ARG_N("min_interval_ms"_a, "float", "0")
 
     PYUNREALSDK_STUBGEN_OVERLOAD_N("add_hook", "bool")
     PYUNREALSDK_STUBGEN_ARG_N("func"_a, "str", )
     PYUNREALSDK_STUBGEN_ARG_N("type"_a, "_PostHookType", )
     PYUNREALSDK_STUBGEN_ARG_N("identifier"_a, "str", )
     PYUNREALSDK_STUBGEN_ARG_N("callback"_a, "_PostHookCallback", )
+    PYUNREALSDK_STUBGEN_ARG_N("filter"_a, "HookFilter | Sequence[HookFilter] | None", "None")
+    PYUNREALSDK_STUBGEN_KW_ONLY_N()
+    PYUNREALSDK_STUBGEN_ARG_N("lazy_ret"_a, "bool", "False")
+    PYUNREALSDK_STUBGEN_ARG_N("every_n"_a, "int", "1")
+    PYUNREALSDK_STUBGEN_ARG_N("min_interval_ms"_a, "float", "0")
 
     PYUNREALSDK_STUBGEN_OVERLOAD_N("add_hook", "bool")
     PYUNREALSDK_STUBGEN_ARG_N("func"_a, "str", )
     PYUNREALSDK_STUBGEN_ARG_N("type"_a, "Type", )
     PYUNREALSDK_STUBGEN_ARG_N("identifier"_a, "str", )
     PYUNREALSDK_STUBGEN_ARG_N("callback"_a, "_PreHookCallback | _PostHookCallback", )
+    PYUNREALSDK_STUBGEN_ARG_N("filter"_a, "HookFilter | Sequence[HookFilter] | None", "None")
+    PYUNREALSDK_STUBGEN_KW_ONLY_N()
+    PYUNREALSDK_STUBGEN_ARG_N("lazy_ret"_a, "bool", "False")
+    PYUNREALSDK_STUBGEN_ARG_N("every_n"_a, "int", "1")
+    PYUNREALSDK_STUBGEN_ARG_N("min_interval_ms"_a, "float", "0")
+
+    hooks.def(
+        PYUNREALSDK_STUBGEN_FUNC("add_native_hook", "bool"), &add_native_hook,
+        PYUNREALSDK_STUBGEN_DOCSTRING(
+            "Adds a hook which runs a set of static actions, without entering python.\n"
+            "\n"
+            "The actions are converted to their unreal form when the hook is added, so the\n"
+            "hook never needs to grab the GIL. Actions are run in order. If any blocks, the\n"
+            "function call is blocked, same as with a regular pre-hook.\n"
+            "\n"
+            "The function does not need to be loaded yet. If it isn't, or if it gets reloaded\n"
+            "later, the actions are instead converted the next time it's called, which\n"
+            "briefly grabs the GIL. Actions which are invalid for the function are then\n"
+            "logged and skipped, rather than raising an exception here.\n"
+            "\n"
+            "Native hooks share the same identifiers as regular hooks, so they may be checked\n"
+            "and removed using has_hook() and remove_hook().\n"
+            "\n"
+            "Args:\n"
+            "    func: The function to hook.\n"
+            "    type: Which type of hook to add.\n"
+            "    identifier: The hook identifier.\n"
+            "    action: An action, or sequence of actions, to run when the hooked function\n"
+            "            is called.\n"
+            "    filter: A filter, or sequence of filters, which must all pass for the actions\n"
+            "            to run.\n"
+            "Returns:\n"
+            "    True if successfully added, false if an identical hook already existed.\n"),
+        PYUNREALSDK_STUBGEN_ARG("func"_a, "str", ), PYUNREALSDK_STUBGEN_ARG("type"_a, "Type", ),
+        PYUNREALSDK_STUBGEN_ARG("identifier"_a, "str", ),
+        PYUNREALSDK_STUBGEN_ARG("action"_a, "HookAction | Sequence[HookAction]", ),
+        PYUNREALSDK_STUBGEN_ARG("filter"_a, "HookFilter | Sequence[HookFilter] | None", "None") =
+            py::none{});
+
+    hooks.def(
+        PYUNREALSDK_STUBGEN_FUNC("get_stats",
+                                 "dict[tuple[str, Type, str], dict[str, int | float]]"),
+        &get_py_hook_stats,
+        PYUNREALSDK_STUBGEN_DOCSTRING(
+            "Gets performance stats for all hooks added via add_hook().\n"
+            "\n"
+            "Each hook's stats contain the following keys:\n"
+            "    calls: How many times the callback was run. Calls skipped by filters are not\n"
+            "           counted.\n"
+            "    total_time: The total time spent running the callback, in seconds. This\n"
+            "                includes any time spent waiting on the GIL.\n"
+            "    max_time: The longest single run of the callback, in seconds.\n"
+            "    gil_wait_time: The total time spent waiting to acquire the GIL before running\n"
+            "                   the callback, in seconds.\n"
+            "    exceptions: How many times the callback raised an exception.\n"
+            "    blocks: How many times the callback requested to block execution.\n"
+            "    overrides: How many times the callback overwrote the return value.\n"
+            "\n"
+            "If the sdk was compiled with stats disabled, all stats stay at zero.\n"
+            "\n"
+            "Returns:\n"
+            "    A dict mapping each hook's (func, type, identifier) to it's stats.\n"));
+
+    hooks.def(PYUNREALSDK_STUBGEN_FUNC("reset_stats", "None"), &reset_py_hook_stats,
+              PYUNREALSDK_STUBGEN_DOCSTRING("Resets the performance stats of all hooks.\n"));
 
-    hooks.def(PYUNREALSDK_STUBGEN_FUNC("has_hook", "bool"), &unrealsdk::hook_manager::has_hook,
+    hooks.def(PYUNREALSDK_STUBGEN_FUNC("has_hook", "bool"), &has_py_hook,
               PYUNREALSDK_STUBGEN_DOCSTRING("Checks if a hook exists.\n"
                                             "\n"
                                             "Args:\n"
@@ -292,7 +947,7 @@ void register_module(py::module_& mod) {
               PYUNREALSDK_STUBGEN_ARG("identifier"_a, "str", ));
 
     hooks.def(
-        PYUNREALSDK_STUBGEN_FUNC("remove_hook", "bool"), &unrealsdk::hook_manager::remove_hook,
+        PYUNREALSDK_STUBGEN_FUNC("remove_hook", "bool"), &remove_py_hook,
         PYUNREALSDK_STUBGEN_DOCSTRING(
             "Removes an existing hook.\n"
             "\n"
@@ -0,0 +1,394 @@
+#include "pyunrealsdk/pch.h"
+#include "pyunrealsdk/hook_action.h"
+#include "pyunrealsdk/logging.h"
+#include "pyunrealsdk/static_py_object.h"
+#include "pyunrealsdk/stubgen.h"
+#include "pyunrealsdk/unreal_bindings/property_access.h"
+#include "unrealsdk/hook_manager.h"
+#include "unrealsdk/unreal/cast.h"
+#include "unrealsdk/unreal/classes/uclass.h"
+#include "unrealsdk/unreal/classes/ufunction.h"
+#include "unrealsdk/unreal/classes/uobject.h"
+#include "unrealsdk/unreal/classes/ustruct.h"
+#include "unrealsdk/unreal/find_class.h"
+#include "unrealsdk/unreal/prop_traits.h"
+#include "unrealsdk/unreal/properties/zarrayproperty.h"
+#include "unrealsdk/unreal/properties/zclassproperty.h"
+#include "unrealsdk/unreal/properties/zcomponentproperty.h"
+#include "unrealsdk/unreal/properties/zdelegateproperty.h"
+#include "unrealsdk/unreal/properties/zinterfaceproperty.h"
+#include "unrealsdk/unreal/properties/zmulticastdelegateproperty.h"
+#include "unrealsdk/unreal/properties/zobjectproperty.h"
+#include "unrealsdk/unreal/properties/zproperty.h"
+#include "unrealsdk/unreal/properties/zstructproperty.h"
+#include "unrealsdk/unreal/wrappers/unreal_pointer.h"
+#include "unrealsdk/unreal/wrappers/weak_pointer.h"
+
+#ifdef PYUNREALSDK_INTERNAL
+
+using namespace unrealsdk::unreal;
+using namespace unrealsdk::hook_manager;
+
+namespace pyunrealsdk::hooks {
+
+namespace {
+
+/**
+ * @brief Copies the value of a property from one object to another.
+ * @note Does not require the GIL.
+ *
+ * @param prop The property to copy.
+ * @param src_addr The base address of the object to copy from.
+ * @param dest_addr The base address of the object to copy to.
+ */
+void copy_property_value(ZProperty* prop, uintptr_t src_addr, uintptr_t dest_addr) {
+    cast(prop, [src_addr, dest_addr]<typename T>(const T* prop) {
+        for (size_t i = 0; i < static_cast<size_t>(prop->ArrayDim()); i++) {
+            set_property<T>(prop, i, dest_addr, get_property<T>(prop, i, src_addr));
+        }
+    });
+}
+
+// True if a property value type is a single object pointer
+template <typename Value>
+constexpr bool is_object_pointer_v =
+    std::is_pointer_v<Value> && std::is_convertible_v<Value, const UObject*>;
+
+/**
+ * @brief Checks if a property's value holds any strong references to objects.
+ *
+ * @param prop The property to check.
+ * @return True if the value may reference an object.
+ */
+bool has_object_refs(const ZProperty* prop) {
+    bool has_refs = false;
+    cast(prop, [&has_refs]<typename T>(const T* prop) {
+        if constexpr (std::is_same_v<T, ZStructProperty>) {
+            has_refs = std::ranges::any_of(prop->Struct()->properties(), has_object_refs);
+        } else if constexpr (std::is_same_v<T, ZArrayProperty>) {
+            has_refs = has_object_refs(prop->Inner());
+        } else {
+            has_refs = std::is_same_v<T, ZClassProperty> || std::is_same_v<T, ZComponentProperty>
+                       || std::is_same_v<T, ZDelegateProperty>
+                       || std::is_same_v<T, ZInterfaceProperty>
+                       || std::is_same_v<T, ZMulticastDelegateProperty>
+                       || std::is_same_v<T, ZObjectProperty>;
+        }
+    });
+    return has_refs;
+}
+
+/**
+ * @brief Checks if a property is a single object pointer, which we can hold weakly.
+ *
+ * @param prop The property to check.
+ * @return True if the property's value is a single object.
+ */
+bool is_single_object(const ZProperty* prop) {
+    if (prop->ArrayDim() != 1) {
+        return false;
+    }
+
+    bool is_object = false;
+    cast(prop, [&is_object]<typename T>(const T* /*prop*/) {
+        using Value = typename PropTraits<T>::Value;
+        is_object = is_object_pointer_v<Value>;
+    });
+    return is_object;
+}
+
+}  // namespace
+
+StoredHookAction::StoredHookAction(const HookAction& action)
+    : kind(action.kind), field_name(action.field_name) {
+    if (action.value.is_none()) {
+        this->is_object_value = true;
+        this->object_value_is_none = true;
+    } else if (py::isinstance<UObject>(action.value)) {
+        this->is_object_value = true;
+        this->object_value = WeakPointer{py::cast<UObject*>(action.value)};
+    } else {
+        this->value = action.value;
+    }
+}
+
+CompiledHookAction::CompiledHookAction(const StoredHookAction& action, UFunction* func)
+    : kind(action.kind) {
+    switch (this->kind) {
+        case HookAction::Kind::BLOCK:
+            return;
+
+        case HookAction::Kind::OVERRIDE_RETURN:
+            this->prop = func->find_return_param();
+            if (this->prop == nullptr) {
+                throw py::value_error(std::format(
+                    "cannot override the return value of void function '{}'", func->Name()));
+            }
+            break;
+
+        case HookAction::Kind::SET_FIELD: {
+            auto outer = func->Outer();
+            if (outer == nullptr || !outer->is_instance(find_class<UClass>())) {
+                throw py::value_error(
+                    std::format("cannot set fields from function '{}', it's not owned by a class",
+                                func->Name()));
+            }
+            this->prop = static_cast<UClass*>(outer)->find_prop(action.field_name);
+            break;
+        }
+
+        default:
+            throw py::value_error("unknown hook action");
+    }
+
+    if (action.is_object_value) {
+        if (!is_single_object(this->prop)) {
+            throw py::value_error(std::format(
+                "cannot use an object value for '{}' in a hook action, it's not a single object",
+                this->prop->Name()));
+        }
+        this->is_object_value = true;
+        this->object_value_is_none = action.object_value_is_none;
+        this->object_value = action.object_value;
+
+        // Do a throwaway set, so we get all the same type checking as a normal set. If the object
+        // already got GC'd, there's nothing to check, the action just does nothing.
+        UObject* obj = *action.object_value;
+        if (obj != nullptr || action.object_value_is_none) {
+            py::object py_obj = py::none{};
+            if (obj != nullptr) {
+                py_obj = py::cast(obj);
+            }
+            const UnrealPointer<void> check{this->prop};
+            pyunrealsdk::unreal::py_setattr_direct(
+                this->prop, reinterpret_cast<uintptr_t>(check.get()), py_obj);
+        }
+        return;
+    }
+
+    if (has_object_refs(this->prop)) {
+        throw py::value_error(
+            std::format("cannot use a value for '{}' in a hook action, it contains object "
+                        "references which would prevent them being garbage collected",
+                        this->prop->Name()));
+    }
+
+    // Convert the value once now, so we can just copy it each time the hook runs
+    this->value = UnrealPointer<void>(this->prop);
+    pyunrealsdk::unreal::py_setattr_direct(
+        this->prop, reinterpret_cast<uintptr_t>(this->value.get()), action.value.obj());
+}
+
+void CompiledHookAction::write_value(uintptr_t dest_addr) const {
+    if (!this->is_object_value) {
+        copy_property_value(this->prop, reinterpret_cast<uintptr_t>(this->value.get()),
+                            dest_addr);
+        return;
+    }
+
+    UObject* obj = *this->object_value;
+    if (obj == nullptr && !this->object_value_is_none) {
+        // The object got GC'd, there's nothing valid left to write
+        return;
+    }
+    cast(this->prop, [dest_addr, obj]<typename T>(const T* prop) {
+        using Value = typename PropTraits<T>::Value;
+        if constexpr (is_object_pointer_v<Value>) {
+            set_property<T>(prop, 0, dest_addr, static_cast<Value>(obj));
+        }
+    });
+}
+
+bool CompiledHookAction::run(Details& hook) const {
+    if (this->kind == HookAction::Kind::BLOCK) {
+        return true;
+    }
+
+    switch (this->kind) {
+        case HookAction::Kind::OVERRIDE_RETURN:
+            if (hook.ret.prop != this->prop) {
+                return false;
+            }
+            if (hook.ret.ptr.get() == nullptr) {
+                hook.ret.ptr = UnrealPointer<void>(hook.ret.prop);
+            }
+            this->write_value(reinterpret_cast<uintptr_t>(hook.ret.ptr.get()));
+            return false;
+
+        case HookAction::Kind::SET_FIELD:
+            if (hook.obj == nullptr) {
+                return false;
+            }
+            this->write_value(reinterpret_cast<uintptr_t>(hook.obj));
+            return false;
+
+        default:
+            return false;
+    }
+}
+
+NativeHookActions::NativeHookActions(const std::vector<HookAction>& actions, UFunction* func) {
+    this->actions.reserve(actions.size());
+    for (const auto& action : actions) {
+        this->actions.emplace_back(action);
+    }
+
+    if (func != nullptr) {
+        // Compile straight away, so that any errors get thrown back to the caller
+        auto compiled = std::make_unique<Compiled>(
+            Compiled{.func = func, .func_index = func->InternalIndex(), .actions = {}});
+        for (const auto& action : this->actions) {
+            compiled->actions.emplace_back(action, func);
+        }
+        this->compiled.store(compiled.get(), std::memory_order_release);
+        this->compilations.push_back(std::move(compiled));
+    }
+}
+
+const NativeHookActions::Compiled& NativeHookActions::compile(UFunction* func) const {
+    const auto* current = this->compiled.load(std::memory_order_acquire);
+    if (current != nullptr && current->func == func
+        && current->func_index == func->InternalIndex()) {
+        return *current;
+    }
+
+    // The GIL doubles as our lock. Don't use a separate mutex, another thread may be holding the
+    // GIL while it waits on it.
+    const py::gil_scoped_acquire gil{};
+
+    // Another thread may have got here first
+    current = this->compiled.load(std::memory_order_relaxed);
+    if (current != nullptr && current->func == func
+        && current->func_index == func->InternalIndex()) {
+        return *current;
+    }
+
+    auto compiled = std::make_unique<Compiled>(
+        Compiled{.func = func, .func_index = func->InternalIndex(), .actions = {}});
+    for (const auto& action : this->actions) {
+        try {
+            compiled->actions.emplace_back(action, func);
+        } catch (const std::exception& ex) {
+            LOG(ERROR, "Failed to compile native hook action, it will be skipped:");
+            LOG(ERROR, "Hooked function: {}", func->get_path_name());
+            logging::log_python_exception(ex);
+        }
+    }
+
+    current = compiled.get();
+    this->compilations.push_back(std::move(compiled));
+    this->compiled.store(current, std::memory_order_release);
+    return *current;
+}
+
+bool NativeHookActions::run(Details& hook) const {
+    bool should_block = false;
+    for (const auto& action : this->compile(hook.func.func).actions) {
+        if (action.run(hook)) {
+            should_block = true;
+        }
+    }
+    return should_block;
+}
+
+std::vector<HookAction> actions_from_py(const py::object& action) {
+    if (py::isinstance<HookAction>(action)) {
+        return {py::cast<HookAction>(action)};
+    }
+
+    std::vector<HookAction> actions{};
+    for (const auto& entry : action) {
+        actions.push_back(py::cast<HookAction>(entry));
+    }
+    if (actions.empty()) {
+        throw py::value_error("native hooks must be given at least one action");
+    }
+    return actions;
+}
+
+void register_hook_action(py::module_& mod) {
+    PYUNREALSDK_STUBGEN_MODULE_N("unrealsdk.hooks")
+
+    py::classh<HookAction>(
+        mod, PYUNREALSDK_STUBGEN_CLASS("HookAction", ),
+        PYUNREALSDK_STUBGEN_DOCSTRING(
+            "A static action for a native hook to perform.\n"
+            "\n"
+            "Actions are converted to their unreal form when the hook is added, running them\n"
+            "never touches python.\n"
+            "\n"
+            "Object values are only held weakly - once the object gets garbage collected, the\n"
+            "action does nothing. Structs or arrays containing objects may not be used.\n"
+            "\n"
+            "If the hooked function gets (re)loaded after the hook was added, the actions are\n"
+            "converted again the next time it's called, which requires briefly grabbing the\n"
+            "GIL. Any which are no longer valid are logged, and skipped.\n"
+            "\n"
+            "Create using the static methods, and pass to add_native_hook().\n"))
+        .def_static(
+            PYUNREALSDK_STUBGEN_STATICMETHOD("block", "HookAction"),
+            []() { return HookAction{.kind = HookAction::Kind::BLOCK}; },
+            PYUNREALSDK_STUBGEN_DOCSTRING(
+                "Creates an action which blocks execution of the hooked function.\n"
+                "\n"
+                "This only has an effect in pre-hooks.\n"
+                "\n"
+                "Returns:\n"
+                "    The new action.\n"))
+        .def_static(
+            PYUNREALSDK_STUBGEN_STATICMETHOD("override_return", "HookAction"),
+            [](const py::object& value) {
+                return HookAction{.kind = HookAction::Kind::OVERRIDE_RETURN, .value = value};
+            },
+            PYUNREALSDK_STUBGEN_DOCSTRING(
+                "Creates an action which overwrites the hooked function's return value.\n"
+                "\n"
+                "Args:\n"
+                "    value: The value to return. Must be convertible to the return type.\n"
+                "Returns:\n"
+                "    The new action.\n"),
+            PYUNREALSDK_STUBGEN_ARG("value"_a, "Any", ))
+        .def_static(
+            PYUNREALSDK_STUBGEN_STATICMETHOD("set_field", "HookAction"),
+            [](const FName& name, const py::object& value) {
+                return HookAction{.kind = HookAction::Kind::SET_FIELD,
+                                  .field_name = name,
+                                  .value = value};
+            },
+            PYUNREALSDK_STUBGEN_DOCSTRING(
+                "Creates an action which sets a field on the object the function was called on.\n"
+                "\n"
+                "The field is looked up on the class which owns the hooked function.\n"
+                "\n"
+                "Args:\n"
+                "    name: The name of the field to set.\n"
+                "    value: The value to set. Must be convertible to the field's type.\n"
+                "Returns:\n"
+                "    The new action.\n"),
+            PYUNREALSDK_STUBGEN_ARG("name"_a, "str | FName", ),
+            PYUNREALSDK_STUBGEN_ARG("value"_a, "Any", ))
+        .def(
+            PYUNREALSDK_STUBGEN_METHOD("__repr__", "str"),
+            [](const HookAction& self) -> std::string {
+                switch (self.kind) {
+                    case HookAction::Kind::BLOCK:
+                        return "<HookAction block>";
+                    case HookAction::Kind::OVERRIDE_RETURN:
+                        return std::format("<HookAction override_return {}>",
+                                           std::string(py::repr(self.value)));
+                    case HookAction::Kind::SET_FIELD:
+                        return std::format("<HookAction set_field {} {}>", self.field_name,
+                                           std::string(py::repr(self.value)));
+                    default:
+                        return "<HookAction>";
+                }
+            },
+            PYUNREALSDK_STUBGEN_DOCSTRING("Gets a string representation of this action.\n"
+                                          "\n"
+                                          "Returns:\n"
+                                          "    The string representation.\n"));
+}
+
+}  // namespace pyunrealsdk::hooks
+
+#endif
@@ -0,0 +1,179 @@
+#ifndef PYUNREALSDK_HOOK_ACTION_H
+#define PYUNREALSDK_HOOK_ACTION_H
+
+#include "pyunrealsdk/pch.h"
+#include "pyunrealsdk/static_py_object.h"
+#include "unrealsdk/hook_manager.h"
+#include "unrealsdk/unreal/structs/fname.h"
+#include "unrealsdk/unreal/wrappers/unreal_pointer.h"
+#include "unrealsdk/unreal/wrappers/weak_pointer.h"
+
+#ifdef PYUNREALSDK_INTERNAL
+
+namespace unrealsdk::unreal {
+
+class UFunction;
+class ZProperty;
+
+}  // namespace unrealsdk::unreal
+
+namespace pyunrealsdk::hooks {
+
+// A static action for a native hook to perform, as created from python.
+class HookAction {
+   public:
+    enum class Kind : uint8_t {
+        BLOCK,
+        OVERRIDE_RETURN,
+        SET_FIELD,
+    };
+
+    Kind kind;
+
+    // Only used by SET_FIELD
+    unrealsdk::unreal::FName field_name;
+    // Only used by OVERRIDE_RETURN and SET_FIELD
+    py::object value;
+};
+
+// A hook action as stored by a native hook, holding on to it's value until it can be compiled.
+struct StoredHookAction {
+    HookAction::Kind kind;
+    unrealsdk::unreal::FName field_name;
+
+    // Object values (and None) are held weakly, so that they may still get GC'd
+    bool is_object_value = false;
+    bool object_value_is_none = false;
+    unrealsdk::unreal::WeakPointer object_value;
+    // Other values can't be converted until we know the property type, so are kept as python
+    StaticPyObject value;
+
+    /**
+     * @brief Stores an action.
+     * @note Requires the GIL.
+     *
+     * @param action The action to store.
+     */
+    StoredHookAction(const HookAction& action);
+};
+
+// A hook action which has been resolved against a specific version of the function it's hooking,
+// ready to run natively.
+class CompiledHookAction {
+   private:
+    HookAction::Kind kind;
+    unrealsdk::unreal::ZProperty* prop = nullptr;
+    // Holds the value to write, already converted to it's unreal form
+    unrealsdk::unreal::UnrealPointer<void> value;
+
+    // Object values are held weakly instead of in the above, so that they may still get GC'd
+    bool is_object_value = false;
+    bool object_value_is_none = false;
+    unrealsdk::unreal::WeakPointer object_value;
+
+    /**
+     * @brief Writes the value of this action.
+     * @note Does not require the GIL.
+     *
+     * @param dest_addr The base address of the object to write to.
+     */
+    void write_value(uintptr_t dest_addr) const;
+
+   public:
+    /**
+     * @brief Converts an action into it's native form.
+     * @note Requires the GIL.
+     *
+     * @param action The action to compile.
+     * @param func The function being hooked.
+     */
+    CompiledHookAction(const StoredHookAction& action, unrealsdk::unreal::UFunction* func);
+
+    /**
+     * @brief Runs this action.
+     * @note Does not require the GIL.
+     *
+     * @param hook The hook details. The hooked function must be the one this was compiled against.
+     * @return True if to block the function call.
+     */
+    bool run(unrealsdk::hook_manager::Details& hook) const;
+};
+
+// All the actions of a single native hook. These are compiled against the hooked function, and
+// compiled again whenever it gets (re)loaded, so the hook may be added before the function exists.
+class NativeHookActions {
+   private:
+    // The actions compiled against a specific version of the hooked function.
+    struct Compiled {
+        const unrealsdk::unreal::UFunction* func;
+        // Used to detect if the function got unloaded, and something else took it's place
+        int32_t func_index;
+        // Any actions which failed to compile are left out
+        std::vector<CompiledHookAction> actions;
+    };
+
+    std::vector<StoredHookAction> actions;
+
+    // The actions compiled against the current version of the hooked function
+    mutable std::atomic<const Compiled*> compiled = nullptr;
+    // Owns every compilation we've made. Replaced ones are kept alive, since another thread may
+    // still be running them. Only accessed while holding the GIL.
+    mutable std::vector<std::unique_ptr<const Compiled>> compilations;
+
+    /**
+     * @brief Gets the actions compiled against the given function, compiling them if required.
+     * @note Does not require the GIL, but grabs it if the actions need to be compiled.
+     *
+     * @param func The hooked function.
+     * @return The compiled actions.
+     */
+    const Compiled& compile(unrealsdk::unreal::UFunction* func) const;
+
+   public:
+    /**
+     * @brief Stores a set of actions for a native hook.
+     * @note Requires the GIL.
+     *
+     * @param actions The actions to store.
+     * @param func The hooked function, if it's already loaded. If given, the actions are compiled
+     *             straight away, and any errors are thrown. Otherwise, they're compiled on the
+     *             first call, and errors are logged.
+     */
+    NativeHookActions(const std::vector<HookAction>& actions, unrealsdk::unreal::UFunction* func);
+
+    NativeHookActions(const NativeHookActions&) = delete;
+    NativeHookActions(NativeHookActions&&) = delete;
+    NativeHookActions& operator=(const NativeHookActions&) = delete;
+    NativeHookActions& operator=(NativeHookActions&&) = delete;
+    ~NativeHookActions() = default;
+
+    /**
+     * @brief Runs all actions, in order.
+     * @note Does not require the GIL, unless the hooked function was (re)loaded since last run.
+     *
+     * @param hook The hook details.
+     * @return True if to block the function call.
+     */
+    bool run(unrealsdk::hook_manager::Details& hook) const;
+};
+
+/**
+ * @brief Converts the action arg passed to `add_native_hook` into a list of actions.
+ *
+ * @param action The python action arg. May be a single action, or a sequence of actions.
+ * @return The list of actions, to be run in order.
+ */
+std::vector<HookAction> actions_from_py(const py::object& action);
+
+/**
+ * @brief Registers HookAction.
+ *
+ * @param module The module to register within.
+ */
+void register_hook_action(py::module_& mod);
+
+}  // namespace pyunrealsdk::hooks
+
+#endif
+
+#endif /* PYUNREALSDK_HOOK_ACTION_H */
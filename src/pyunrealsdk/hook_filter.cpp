@@ -0,0 +1,364 @@
+#include "pyunrealsdk/pch.h"
+#include "pyunrealsdk/hook_filter.h"
+#include "pyunrealsdk/fname.h"
+#include "pyunrealsdk/stubgen.h"
+#include "unrealsdk/hook_manager.h"
+#include "unrealsdk/unreal/cast.h"
+#include "unrealsdk/unreal/classes/uclass.h"
+#include "unrealsdk/unreal/classes/ufunction.h"
+#include "unrealsdk/unreal/classes/uobject.h"
+#include "unrealsdk/unreal/classes/ustruct.h"
+#include "unrealsdk/unreal/prop_traits.h"
+#include "unrealsdk/unreal/properties/zproperty.h"
+#include "unrealsdk/unreal/structs/fname.h"
+#include "unrealsdk/unreal/wrappers/weak_pointer.h"
+#include "unrealsdk/unreal/wrappers/wrapped_struct.h"
+#include "unrealsdk/utils.h"
+
+#ifdef PYUNREALSDK_INTERNAL
+
+using namespace unrealsdk::unreal;
+using namespace unrealsdk::hook_manager;
+
+namespace pyunrealsdk::hooks {
+
+namespace {
+
+/**
+ * @brief Converts a python value into a filter constant.
+ *
+ * @param value The python value.
+ * @return The filter constant.
+ */
+HookFilter::Constant constant_from_py(const py::object& value) {
+    if (value.is_none()) {
+        return HookFilter::ObjectConstant{.is_none = true};
+    }
+    // Need to check bools before ints, since they're a subclass
+    if (py::isinstance<py::bool_>(value)) {
+        return py::cast<bool>(value);
+    }
+    if (py::isinstance<py::int_>(value)) {
+        return py::cast<int64_t>(value);
+    }
+    if (py::isinstance<py::float_>(value)) {
+        return py::cast<double>(value);
+    }
+    if (py::isinstance<py::str>(value)) {
+        // Keep the exact string, names are case insensitive but strs are not
+        return HookFilter::StringConstant{.str = py::cast<std::wstring>(value)};
+    }
+    if (const auto* name = get_py_fname(value.ptr()); name != nullptr) {
+        return HookFilter::StringConstant{.str = unrealsdk::utils::widen(*name), .name = *name};
+    }
+    if (py::isinstance<UObject>(value)) {
+        return HookFilter::ObjectConstant{.obj = WeakPointer{py::cast<UObject*>(value)}};
+    }
+
+    throw py::type_error(
+        std::format("cannot filter on args equal to a '{}', only None, bool, int, float, str, "
+                    "FName, or UObject are supported",
+                    std::string(py::str(py::type::of(value).attr("__name__")))));
+}
+
+/**
+ * @brief Normalizes an arithmetic value so it can be passed to the standard integer comparisons.
+ *
+ * @param value The value to normalize.
+ * @return The normalized value.
+ */
+template <typename T>
+auto normalize_arithmetic(T value) {
+    if constexpr (std::is_same_v<T, bool>) {
+        return static_cast<int64_t>(value);
+    } else {
+        return value;
+    }
+}
+
+/**
+ * @brief Compares an unreal value against a filter constant.
+ *
+ * @tparam Value The type of the unreal value.
+ * @param value The unreal value.
+ * @param constant The constant to compare against.
+ * @param resolved The resolved arg being compared.
+ * @return True if the two are equal, false if they're not, or if they can't be compared.
+ */
+template <typename Value>
+bool constant_equals(const Value& value,
+                     const HookFilter::Constant& constant,
+                     const BoundHookFilter::ResolvedArg& resolved) {
+    return std::visit(
+        [&value, &resolved]<typename C>(const C& constant) -> bool {
+            if constexpr (std::is_arithmetic_v<Value> && std::is_arithmetic_v<C>) {
+                auto lhs = normalize_arithmetic(value);
+                auto rhs = normalize_arithmetic(constant);
+                if constexpr (std::is_integral_v<decltype(lhs)>
+                              && std::is_integral_v<decltype(rhs)>) {
+                    return std::cmp_equal(lhs, rhs);
+                } else {
+                    return static_cast<double>(lhs) == static_cast<double>(rhs);
+                }
+            } else if constexpr (std::is_same_v<C, HookFilter::StringConstant>) {
+                if constexpr (std::is_same_v<Value, std::wstring>) {
+                    return value == constant.str;
+                } else if constexpr (std::is_same_v<Value, FName>) {
+                    return resolved.name.has_value() && value == *resolved.name;
+                } else {
+                    return false;
+                }
+            } else if constexpr (std::is_same_v<C, HookFilter::ObjectConstant>
+                                 && std::is_convertible_v<Value, const UObject*>) {
+                const UObject* obj = *constant.obj;
+                if (obj == nullptr && !constant.is_none) {
+                    // The object got GC'd, nothing can be equal to it anymore
+                    return false;
+                }
+                return value == obj;
+            } else {
+                return false;
+            }
+        },
+        constant);
+}
+
+/**
+ * @brief Checks if the named arg of a hook is equal to a filter's constant.
+ *
+ * @param hook The hook details.
+ * @param filter The filter to check.
+ * @param resolved The filter's arg, resolved against the hooked function.
+ * @return True if the arg exists and is equal to the constant.
+ */
+bool arg_equals(const Details& hook,
+                const HookFilter& filter,
+                const BoundHookFilter::ResolvedArg& resolved) {
+    if (resolved.prop == nullptr) {
+        return false;
+    }
+
+    auto base_addr = reinterpret_cast<uintptr_t>(hook.args->base.get());
+    bool equal = false;
+    cast(resolved.prop, [base_addr, &filter, &resolved, &equal]<typename T>(const T* prop) {
+        using Value = typename PropTraits<T>::Value;
+        if constexpr (std::is_arithmetic_v<Value> || std::is_same_v<Value, std::wstring>
+                      || std::is_same_v<Value, FName>
+                      || std::is_convertible_v<Value, const UObject*>) {
+            equal = constant_equals(get_property<T>(prop, 0, base_addr), filter.constant, resolved);
+        }
+    });
+    return equal;
+}
+
+}  // namespace
+
+BoundHookFilter::BoundHookFilter(const HookFilter& filter, const UFunction* func) : filter(filter) {
+    if (func != nullptr) {
+        this->resolve(func);
+    }
+}
+
+const BoundHookFilter::ResolvedArg& BoundHookFilter::resolve(const UFunction* func) const {
+    const auto* current = this->resolved.load(std::memory_order_acquire);
+    if (current != nullptr && current->func == func
+        && current->func_index == func->InternalIndex()) {
+        return *current;
+    }
+
+    const std::lock_guard<std::mutex> lock{this->resolve_mutex};
+
+    // Another thread may have got here first
+    current = this->resolved.load(std::memory_order_relaxed);
+    if (current != nullptr && current->func == func
+        && current->func_index == func->InternalIndex()) {
+        return *current;
+    }
+
+    auto resolved_arg = std::make_unique<ResolvedArg>(
+        ResolvedArg{.func = func, .func_index = func->InternalIndex()});
+    for (auto prop : func->properties()) {
+        if (prop->Name() == this->filter.arg_name) {
+            resolved_arg->prop = prop;
+            break;
+        }
+    }
+
+    const auto* str = std::get_if<HookFilter::StringConstant>(&this->filter.constant);
+    if (resolved_arg->prop != nullptr && str != nullptr) {
+        cast(resolved_arg->prop, [&resolved_arg, str]<typename T>(const T* /*prop*/) {
+            if constexpr (std::is_same_v<typename PropTraits<T>::Value, FName>) {
+                resolved_arg->name = str->name.value_or(FName{str->str});
+            }
+        });
+    }
+
+    current = resolved_arg.get();
+    this->resolutions.push_back(std::move(resolved_arg));
+    this->resolved.store(current, std::memory_order_release);
+    return *current;
+}
+
+bool BoundHookFilter::matches(const Details& hook) const {
+    switch (this->filter.kind) {
+        case HookFilter::Kind::OBJECT:
+            return hook.obj != nullptr && hook.obj == *this->filter.obj;
+        case HookFilter::Kind::INSTANCE_OF: {
+            if (hook.obj == nullptr) {
+                return false;
+            }
+            auto* cls = static_cast<UClass*>(*this->filter.cls);
+            return cls != nullptr && hook.obj->is_instance(cls);
+        }
+        case HookFilter::Kind::ARG_EQUALS:
+            return arg_equals(hook, this->filter, this->resolve(hook.func.func));
+        case HookFilter::Kind::ARG_NOT_EQUALS:
+            return !arg_equals(hook, this->filter, this->resolve(hook.func.func));
+        default:
+            return true;
+    }
+}
+
+std::vector<HookFilter> filters_from_py(const py::object& filter) {
+    if (filter.is_none()) {
+        return {};
+    }
+    if (py::isinstance<HookFilter>(filter)) {
+        return {py::cast<HookFilter>(filter)};
+    }
+
+    std::vector<HookFilter> filters{};
+    for (const auto& entry : filter) {
+        filters.push_back(py::cast<HookFilter>(entry));
+    }
+    return filters;
+}
+
+BoundHookFilters bind_filters(const std::vector<HookFilter>& filters, const UFunction* func) {
+    BoundHookFilters bound{};
+    bound.reserve(filters.size());
+    for (const auto& filter : filters) {
+        bound.push_back(std::make_unique<const BoundHookFilter>(filter, func));
+    }
+    return bound;
+}
+
+void register_hook_filter(py::module_& mod) {
+    PYUNREALSDK_STUBGEN_MODULE_N("unrealsdk.hooks")
+
+    py::classh<HookFilter>(
+        mod, PYUNREALSDK_STUBGEN_CLASS("HookFilter", ),
+        PYUNREALSDK_STUBGEN_DOCSTRING(
+            "A condition a hook's details must meet for it's callback to run.\n"
+            "\n"
+            "Filters are checked natively, calls which don't pass never touch python.\n"
+            "\n"
+            "Create using the static methods, and pass to add_hook().\n"))
+        .def_static(
+            PYUNREALSDK_STUBGEN_STATICMETHOD("obj", "HookFilter"),
+            [](const UObject* obj) {
+                if (obj == nullptr) {
+                    throw py::value_error("cannot filter on a null object");
+                }
+                return HookFilter{.kind = HookFilter::Kind::OBJECT, .obj = WeakPointer{obj}};
+            },
+            PYUNREALSDK_STUBGEN_DOCSTRING(
+                "Creates a filter which only passes calls on a specific object.\n"
+                "\n"
+                "Args:\n"
+                "    obj: The object to match. This is held by a weak reference.\n"
+                "Returns:\n"
+                "    The new filter.\n"),
+            PYUNREALSDK_STUBGEN_ARG("obj"_a, "UObject", ))
+        .def_static(
+            PYUNREALSDK_STUBGEN_STATICMETHOD("instance_of", "HookFilter"),
+            [](UClass* cls) {
+                if (cls == nullptr) {
+                    throw py::value_error("cannot filter on a null class");
+                }
+                return HookFilter{.kind = HookFilter::Kind::INSTANCE_OF, .cls = WeakPointer{cls}};
+            },
+            PYUNREALSDK_STUBGEN_DOCSTRING(
+                "Creates a filter which only passes calls on instances of a class.\n"
+                "\n"
+                "Args:\n"
+                "    cls: The class to match, including subclasses. This is held by a weak\n"
+                "         reference, if it gets garbage collected, no calls match.\n"
+                "Returns:\n"
+                "    The new filter.\n"),
+            PYUNREALSDK_STUBGEN_ARG("cls"_a, "UClass", ))
+        .def_static(
+            PYUNREALSDK_STUBGEN_STATICMETHOD("arg_equals", "HookFilter"),
+            [](const FName& name, const py::object& value) {
+                return HookFilter{.kind = HookFilter::Kind::ARG_EQUALS,
+                                  .arg_name = name,
+                                  .constant = constant_from_py(value)};
+            },
+            PYUNREALSDK_STUBGEN_DOCSTRING(
+                "Creates a filter which only passes calls where an arg equals a constant.\n"
+                "\n"
+                "Only bool, numeric, str, name, and object args may be compared. Calls where\n"
+                "the arg doesn't exist, or has any other type, never pass.\n"
+                "\n"
+                "Args:\n"
+                "    name: The name of the arg to check.\n"
+                "    value: The value to compare against.\n"
+                "Returns:\n"
+                "    The new filter.\n"),
+            PYUNREALSDK_STUBGEN_ARG("name"_a, "str | FName", ),
+            PYUNREALSDK_STUBGEN_ARG("value"_a, "bool | int | float | str | FName | UObject | None",
+                                    ))
+        .def_static(
+            PYUNREALSDK_STUBGEN_STATICMETHOD("arg_not_equals", "HookFilter"),
+            [](const FName& name, const py::object& value) {
+                return HookFilter{.kind = HookFilter::Kind::ARG_NOT_EQUALS,
+                                  .arg_name = name,
+                                  .constant = constant_from_py(value)};
+            },
+            PYUNREALSDK_STUBGEN_DOCSTRING(
+                "Creates a filter which only passes calls where an arg does not equal a constant.\n"
+                "\n"
+                "This is the exact inverse of arg_equals(), so calls where the arg can't be\n"
+                "compared always pass.\n"
+                "\n"
+                "Args:\n"
+                "    name: The name of the arg to check.\n"
+                "    value: The value to compare against.\n"
+                "Returns:\n"
+                "    The new filter.\n"),
+            PYUNREALSDK_STUBGEN_ARG("name"_a, "str | FName", ),
+            PYUNREALSDK_STUBGEN_ARG("value"_a, "bool | int | float | str | FName | UObject | None",
+                                    ))
+        .def(
+            PYUNREALSDK_STUBGEN_METHOD("__repr__", "str"),
+            [](const HookFilter& self) -> std::string {
+                switch (self.kind) {
+                    case HookFilter::Kind::OBJECT: {
+                        auto obj = *self.obj;
+                        return std::format(
+                            "<HookFilter obj {}>",
+                            obj == nullptr ? "None"
+                                           : unrealsdk::utils::narrow(obj->get_path_name()));
+                    }
+                    case HookFilter::Kind::INSTANCE_OF: {
+                        auto cls = *self.cls;
+                        return std::format("<HookFilter instance_of {}>",
+                                           cls == nullptr ? "None" : std::string{cls->Name()});
+                    }
+                    case HookFilter::Kind::ARG_EQUALS:
+                        return std::format("<HookFilter arg_equals {}>", self.arg_name);
+                    case HookFilter::Kind::ARG_NOT_EQUALS:
+                        return std::format("<HookFilter arg_not_equals {}>", self.arg_name);
+                    default:
+                        return "<HookFilter>";
+                }
+            },
+            PYUNREALSDK_STUBGEN_DOCSTRING("Gets a string representation of this filter.\n"
+                                          "\n"
+                                          "Returns:\n"
+                                          "    The string representation.\n"));
+}
+
+}  // namespace pyunrealsdk::hooks
+
+#endif
@@ -0,0 +1,149 @@
+#ifndef PYUNREALSDK_HOOK_FILTER_H
+#define PYUNREALSDK_HOOK_FILTER_H
+
+#include "pyunrealsdk/pch.h"
+#include "unrealsdk/hook_manager.h"
+#include "unrealsdk/unreal/structs/fname.h"
+#include "unrealsdk/unreal/wrappers/weak_pointer.h"
+
+#ifdef PYUNREALSDK_INTERNAL
+
+namespace unrealsdk::unreal {
+
+class UClass;
+class UFunction;
+class UObject;
+class ZProperty;
+
+}  // namespace unrealsdk::unreal
+
+namespace pyunrealsdk::hooks {
+
+// A predicate on a hook's details, which is evaluated natively, before running any python.
+class HookFilter {
+   public:
+    enum class Kind : uint8_t {
+        OBJECT,
+        INSTANCE_OF,
+        ARG_EQUALS,
+        ARG_NOT_EQUALS,
+    };
+
+    // Strings may be compared against both str and name args. We only create the name form once we
+    // find we're comparing against a name arg, since it permanently adds it to the name table.
+    struct StringConstant {
+        std::wstring str;
+        // Only set upfront if given an FName
+        std::optional<unrealsdk::unreal::FName> name;
+    };
+    // Held weakly, so that a new object allocated at the same address doesn't match
+    struct ObjectConstant {
+        unrealsdk::unreal::WeakPointer obj;
+        bool is_none = false;
+    };
+    // The constant to compare an arg against.
+    using Constant = std::variant<bool, int64_t, double, StringConstant, ObjectConstant>;
+
+    Kind kind;
+
+    // Only used by OBJECT
+    unrealsdk::unreal::WeakPointer obj;
+    // Only used by INSTANCE_OF. An expired class never matches.
+    unrealsdk::unreal::WeakPointer cls;
+    // Only used by ARG_EQUALS and ARG_NOT_EQUALS
+    unrealsdk::unreal::FName arg_name;
+    Constant constant;
+};
+
+// A filter attached to a specific hook. Arg filters resolve their arg against the hooked function
+// once, rather than on every call.
+class BoundHookFilter {
+   public:
+    // The arg property, as resolved against a specific function.
+    struct ResolvedArg {
+        const unrealsdk::unreal::UFunction* func = nullptr;
+        // Used to detect if the function got unloaded, and something else took it's place
+        int32_t func_index = -1;
+        // Null if the function has no such arg
+        const unrealsdk::unreal::ZProperty* prop = nullptr;
+        // The name form of a string constant, only set when comparing against a name arg
+        std::optional<unrealsdk::unreal::FName> name;
+    };
+
+   private:
+    HookFilter filter;
+
+    // The arg resolved against the current version of the hooked function. This is only replaced
+    // if the function gets (re)loaded, so checking it is just a couple of comparisons.
+    mutable std::atomic<const ResolvedArg*> resolved = nullptr;
+    // Owns every resolution we've made. Replaced ones are kept alive, since another thread may
+    // still be using them. Only accessed while holding the mutex.
+    mutable std::mutex resolve_mutex;
+    mutable std::vector<std::unique_ptr<const ResolvedArg>> resolutions;
+
+    /**
+     * @brief Gets the arg resolved against the given function, resolving it again if required.
+     * @note Does not require the GIL.
+     *
+     * @param func The hooked function.
+     * @return The resolved arg.
+     */
+    const ResolvedArg& resolve(const unrealsdk::unreal::UFunction* func) const;
+
+   public:
+    /**
+     * @brief Binds a filter to a hook.
+     *
+     * @param filter The filter to bind.
+     * @param func The hooked function, if it's already loaded. If null, resolves on the first call.
+     */
+    BoundHookFilter(const HookFilter& filter, const unrealsdk::unreal::UFunction* func);
+
+    BoundHookFilter(const BoundHookFilter&) = delete;
+    BoundHookFilter(BoundHookFilter&&) = delete;
+    BoundHookFilter& operator=(const BoundHookFilter&) = delete;
+    BoundHookFilter& operator=(BoundHookFilter&&) = delete;
+    ~BoundHookFilter() = default;
+
+    /**
+     * @brief Checks if a hook's details pass this filter.
+     * @note Does not require the GIL.
+     *
+     * @param hook The hook details.
+     * @return True if the hook should run.
+     */
+    [[nodiscard]] bool matches(const unrealsdk::hook_manager::Details& hook) const;
+};
+
+using BoundHookFilters = std::vector<std::unique_ptr<const BoundHookFilter>>;
+
+/**
+ * @brief Converts the filter arg passed to `add_hook` into a list of filters.
+ *
+ * @param filter The python filter arg. May be None, a single filter, or a sequence of filters.
+ * @return The list of filters, all of which must match.
+ */
+std::vector<HookFilter> filters_from_py(const py::object& filter);
+
+/**
+ * @brief Binds a list of filters to a hook.
+ *
+ * @param filters The filters to bind.
+ * @param func The hooked function, if it's already loaded.
+ * @return The bound filters.
+ */
+BoundHookFilters bind_filters(const std::vector<HookFilter>& filters,
+                              const unrealsdk::unreal::UFunction* func);
+
+/**
+ * @brief Registers HookFilter.
+ *
+ * @param module The module to register within.
+ */
+void register_hook_filter(py::module_& mod);
+
+}  // namespace pyunrealsdk::hooks
+
+#endif
+
+#endif /* PYUNREALSDK_HOOK_FILTER_H */
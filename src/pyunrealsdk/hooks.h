@@ -19,6 +19,13 @@ void register_module(py::module_& mod);
  * @return True if we should auto inject python calls.
  */
 bool should_auto_inject_py_calls(void);
+
+/**
+ * @brief Checks if the current thread is currently running a python hook.
+ *
+ * @return True if inside a hook.
+ */
+bool is_in_hook(void);
 #endif
 
 /**
@@ -2,10 +2,12 @@
 #include "pyunrealsdk/pyunrealsdk.h"
 #include "pyunrealsdk/base_bindings.h"
 #include "pyunrealsdk/commands.h"
+#include "pyunrealsdk/fname.h"
 #include "pyunrealsdk/hooks.h"
 #include "pyunrealsdk/logging.h"
 #include "pyunrealsdk/stubgen.h"
 #include "pyunrealsdk/unreal_bindings/bindings.h"
+#include "pyunrealsdk/unreal_bindings/bulk_access.h"
 #include "pyunrealsdk/version.h"
 #include "unrealsdk/config.h"
 #include "unrealsdk/unrealsdk.h"
@@ -26,11 +28,13 @@ PYBIND11_EMBEDDED_MODULE(unrealsdk, m) {
                        (unrealsdk_version >> 0) & 0xFF);
     // NOLINTEND(readability-magic-numbers)
 
+    pyunrealsdk::register_fname(m);
     pyunrealsdk::logging::register_module(m);
     pyunrealsdk::commands::register_module(m);
     pyunrealsdk::unreal::register_module(m);
     pyunrealsdk::hooks::register_module(m);
     pyunrealsdk::register_base_bindings(m);
+    pyunrealsdk::unreal::register_bulk_access(m);
 };
 
 // NOLINTNEXTLINE(readability-identifier-length)
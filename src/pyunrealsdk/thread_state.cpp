@@ -0,0 +1,25 @@
+#include "pyunrealsdk/pch.h"
+#include "pyunrealsdk/thread_state.h"
+
+#ifdef PYUNREALSDK_INTERNAL
+
+namespace pyunrealsdk {
+
+void keep_thread_state(void) {
+    thread_local bool kept = false;
+    if (kept) {
+        return;
+    }
+
+    // Add an extra reference to this thread's gil state, which we intentionally never release.
+    // Since the count then never drops to zero, releasing the GIL only detaches the thread state,
+    // and the next acquire can restore it, rather than having to create a new one.
+    // The state lives for as long as the thread does - or until finalization, which clears all
+    // remaining thread states.
+    PyGILState_Ensure();
+    kept = true;
+}
+
+}  // namespace pyunrealsdk
+
+#endif
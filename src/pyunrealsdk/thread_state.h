@@ -0,0 +1,23 @@
+#ifndef PYUNREALSDK_THREAD_STATE_H
+#define PYUNREALSDK_THREAD_STATE_H
+
+#include "pyunrealsdk/pch.h"
+
+namespace pyunrealsdk {
+
+#ifdef PYUNREALSDK_INTERNAL
+
+/**
+ * @brief Makes the current thread keep it's python thread state after releasing the GIL.
+ * @note Must be called while holding the GIL.
+ * @note Intended for engine threads which repeatedly call into python (e.g. from hooks). Without
+ *       this, every `gil_scoped_acquire` on a non-python thread creates a new thread state, and
+ *       destroys it again on release. After calling this, they just re-attach the existing one.
+ */
+void keep_thread_state(void);
+
+#endif
+
+}  // namespace pyunrealsdk
+
+#endif /* PYUNREALSDK_THREAD_STATE_H */
@@ -1,9 +1,13 @@
 #include "pyunrealsdk/pch.h"
 #include "pyunrealsdk/type_casters.h"
 #include "pyunrealsdk/exports.h"
+#include "pyunrealsdk/fname.h"
+#include "pyunrealsdk/unreal_bindings/generated_types.h"
 #include "unrealsdk/unreal/cast.h"
+#include "unrealsdk/unreal/classes/uclass.h"
 #include "unrealsdk/unreal/classes/uobject.h"
 #include "unrealsdk/unreal/structs/ffield.h"
+#include "unrealsdk/unreal/structs/fname.h"
 #include "unrealsdk/unreal/wrappers/wrapped_struct.h"
 
 using namespace unrealsdk::unreal;
@@ -28,8 +32,73 @@ const void* downcast_unreal_impl(const SourceType* src, const std::type_info*& t
     return src;
 }
 
+// Past this many entries, the FName caches stop growing, and we fall back to uncached conversions.
+// Attribute names only make up a small set, but casting the names of every object (e.g. after a
+// `find_all`) could otherwise grow them indefinitely.
+const constexpr size_t fname_cache_max_size = 0x10000;
+
+// Both these caches hold a strong reference to each string, so the pointers can't be reused. They
+// deliberately leak these references, same as Python would with the interned strings themselves.
+// Since all conversions happen while holding the GIL, they don't need any other locking.
+std::unordered_map<PyObject*, FName> interned_str_to_fname{};
+std::unordered_map<FName, PyObject*> fname_to_interned_str{};
+
 }  // namespace
 
+bool load_fname(PyObject* src, FName& name) {
+    if (!PyUnicode_Check(src)) {
+        // Python FName objects already hold a name, so don't need any conversion
+        auto py_fname = get_py_fname(src);
+        if (py_fname == nullptr) {
+            return false;
+        }
+        name = *py_fname;
+        return true;
+    }
+
+    // Attribute names are almost always interned, so we can cache them based on their address
+    const bool interned = PyUnicode_CHECK_INTERNED(src) != 0;
+    if (interned) {
+        auto iter = interned_str_to_fname.find(src);
+        if (iter != interned_str_to_fname.end()) {
+            name = iter->second;
+            return true;
+        }
+    }
+
+    py::ssize_t size = 0;
+    const char* str = PyUnicode_AsUTF8AndSize(src, &size);
+    if (str == nullptr) {
+        PyErr_Clear();
+        return false;
+    }
+
+    name = FName{std::string{str, static_cast<size_t>(size)}};
+
+    if (interned && interned_str_to_fname.size() < fname_cache_max_size) {
+        interned_str_to_fname.emplace(Py_NewRef(src), name);
+    }
+    return true;
+}
+
+PyObject* cast_fname(const FName& name) {
+    auto iter = fname_to_interned_str.find(name);
+    if (iter != fname_to_interned_str.end()) {
+        return Py_NewRef(iter->second);
+    }
+
+    const std::string str = name;
+    PyObject* py_str =
+        PyUnicode_FromStringAndSize(str.c_str(), static_cast<py::ssize_t>(str.size()));
+    if (py_str == nullptr || fname_to_interned_str.size() >= fname_cache_max_size) {
+        return py_str;
+    }
+
+    PyUnicode_InternInPlace(&py_str);
+    fname_to_interned_str.emplace(name, Py_NewRef(py_str));
+    return py_str;
+}
+
 const void* downcast_unreal(const UObject* src, const std::type_info*& type) {
     return downcast_unreal_impl(src, type);
 }
@@ -37,6 +106,23 @@ const void* downcast_unreal(const FField* src, const std::type_info*& type) {
     return downcast_unreal_impl(src, type);
 }
 
+const py::detail::type_info* pick_type_info(const UObject* src,
+                                            const py::detail::type_info* base) {
+    if (src == nullptr || base == nullptr || !unreal::generated_types_enabled()) {
+        return base;
+    }
+    return unreal::get_generated_type_info(src->Class(), base);
+}
+
+const py::detail::type_info* pick_type_info(const WrappedStruct* src,
+                                            const py::detail::type_info* base) {
+    if (src == nullptr || src->type == nullptr || base == nullptr
+        || !unreal::generated_types_enabled()) {
+        return base;
+    }
+    return unreal::get_generated_type_info(src->type, base);
+}
+
 #endif
 
 PYUNREALSDK_CAPI(PyObject*, cast_from_object, UObject* src);
@@ -118,3 +204,36 @@ FField* cast<FField*>(const py::object& src) {
 #endif
 
 }  // namespace pyunrealsdk::type_casters
+
+#ifdef PYUNREALSDK_INTERNAL
+
+namespace pybind11::detail {
+
+handle type_caster<WrappedStruct>::cast(const WrappedStruct& src,
+                                        return_value_policy policy,
+                                        handle parent) {
+    if (policy == return_value_policy::automatic
+        || policy == return_value_policy::automatic_reference) {
+        policy = return_value_policy::copy;
+    }
+    return cast(&src, policy, parent);
+}
+
+handle type_caster<WrappedStruct>::cast(WrappedStruct&& src,
+                                        return_value_policy /*policy*/,
+                                        handle parent) {
+    return cast(&src, return_value_policy::move, parent);
+}
+
+handle type_caster<WrappedStruct>::cast(const WrappedStruct* src,
+                                        return_value_policy policy,
+                                        handle parent) {
+    auto [vsrc, tinfo] = src_and_type(src);
+    return type_caster_generic::cast(vsrc, policy, parent,
+                                     pyunrealsdk::type_casters::pick_type_info(src, tinfo),
+                                     make_copy_constructor(src), make_move_constructor(src));
+}
+
+}  // namespace pybind11::detail
+
+#endif
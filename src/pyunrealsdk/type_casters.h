@@ -29,6 +29,38 @@ namespace pyunrealsdk::type_casters {
 const void* downcast_unreal(const unrealsdk::unreal::UObject* src, const std::type_info*& type);
 const void* downcast_unreal(const unrealsdk::unreal::FField* src, const std::type_info*& type);
 
+/**
+ * @brief Picks the pybind type info to use when casting an unreal object or struct to python.
+ * @note Only differs from the base type info if generated types are enabled.
+ *
+ * @param src The source object/struct being cast.
+ * @param base The type info pybind would normally use (after downcasting).
+ * @return The type info to cast using.
+ */
+const py::detail::type_info* pick_type_info(const unrealsdk::unreal::UObject* src,
+                                            const py::detail::type_info* base);
+const py::detail::type_info* pick_type_info(const unrealsdk::unreal::WrappedStruct* src,
+                                            const py::detail::type_info* base);
+
+/**
+ * @brief Converts a python string or FName object to an FName.
+ * @note Uses a cache keyed on interned strings, so repeated attribute names skip the name lookup.
+ *
+ * @param src The source python object.
+ * @param name The FName to write to.
+ * @return True if the conversion succeeded, false if the source was not a string or FName.
+ */
+bool load_fname(PyObject* src, unrealsdk::unreal::FName& name);
+
+/**
+ * @brief Converts an FName to a python string.
+ * @note Returns a cached interned string for names which have been converted before.
+ *
+ * @param name The FName to convert.
+ * @return A new reference to the python string, or nullptr on error.
+ */
+PyObject* cast_fname(const unrealsdk::unreal::FName& name);
+
 #endif
 
 #ifndef PYUNREALSDK_INTERNAL
@@ -90,6 +122,56 @@ struct polymorphic_type_hook<
 
 namespace detail {
 
+#ifdef PYUNREALSDK_INTERNAL
+// Make UObjects/WrappedStructs able to cast to their generated types
+
+template <typename itype>
+class type_caster<itype, enable_if_t<std::is_base_of_v<unrealsdk::unreal::UObject, itype>>>
+    : public type_caster_base<itype> {
+    using base = type_caster_base<itype>;
+
+   public:
+    using base::cast;
+
+    static handle cast(const itype& src, return_value_policy policy, handle parent) {
+        if (policy == return_value_policy::automatic
+            || policy == return_value_policy::automatic_reference) {
+            policy = return_value_policy::copy;
+        }
+        return cast(&src, policy, parent);
+    }
+
+    static handle cast(const itype* src, return_value_policy policy, handle parent) {
+        auto [vsrc, tinfo] = base::src_and_type(src);
+        return type_caster_generic::cast(vsrc, policy, parent,
+                                         pyunrealsdk::type_casters::pick_type_info(src, tinfo),
+                                         base::make_copy_constructor(src),
+                                         base::make_move_constructor(src));
+    }
+};
+
+template <>
+class type_caster<unrealsdk::unreal::WrappedStruct>
+    : public type_caster_base<unrealsdk::unreal::WrappedStruct> {
+    using base = type_caster_base<unrealsdk::unreal::WrappedStruct>;
+
+   public:
+    using base::cast;
+
+    // Defined in type_casters.cpp, since we only have a forward declaration of WrappedStruct here
+    static handle cast(const unrealsdk::unreal::WrappedStruct& src,
+                       return_value_policy policy,
+                       handle parent);
+    static handle cast(unrealsdk::unreal::WrappedStruct&& src,
+                       return_value_policy policy,
+                       handle parent);
+    static handle cast(const unrealsdk::unreal::WrappedStruct* src,
+                       return_value_policy policy,
+                       handle parent);
+};
+
+#endif
+
 // Allow FNames to cast to/from python strings
 template <>
 struct type_caster<unrealsdk::unreal::FName> {
@@ -100,6 +182,9 @@ struct type_caster<unrealsdk::unreal::FName> {
     PYBIND11_TYPE_CASTER(unrealsdk::unreal::FName, py::detail::const_name("str"));
 
     bool load(handle src, bool /*convert*/) {
+#ifdef PYUNREALSDK_INTERNAL
+        return pyunrealsdk::type_casters::load_fname(src.ptr(), value);
+#else
         py::ssize_t size = 0;
         const char* str = PyUnicode_AsUTF8AndSize(src.ptr(), &size);
 
@@ -109,13 +194,18 @@ struct type_caster<unrealsdk::unreal::FName> {
 
         value = unrealsdk::unreal::FName(std::string{str, static_cast<size_t>(size)});
         return true;
+#endif
     }
 
     static handle cast(unrealsdk::unreal::FName src,
                        return_value_policy /* policy */,
                        handle /* parent */) {
+#ifdef PYUNREALSDK_INTERNAL
+        return pyunrealsdk::type_casters::cast_fname(src);
+#else
         std::string name = src;
         return PyUnicode_FromStringAndSize(name.c_str(), static_cast<py::ssize_t>(name.size()));
+#endif
     }
 };
 
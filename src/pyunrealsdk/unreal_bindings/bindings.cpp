@@ -2,8 +2,12 @@
 #include "pyunrealsdk/unreal_bindings/bindings.h"
 #include "pyunrealsdk/stubgen.h"
 #include "pyunrealsdk/unreal_bindings/bound_function.h"
+#include "pyunrealsdk/unreal_bindings/compiled_path.h"
 #include "pyunrealsdk/unreal_bindings/experimental_gbx_types.h"
+#include "pyunrealsdk/unreal_bindings/field_accessor.h"
+#include "pyunrealsdk/unreal_bindings/generated_types.h"
 #include "pyunrealsdk/unreal_bindings/persistent_object_ptr_property.h"
+#include "pyunrealsdk/unreal_bindings/prepared_call.h"
 #include "pyunrealsdk/unreal_bindings/property_access.h"
 #include "pyunrealsdk/unreal_bindings/uenum.h"
 #include "pyunrealsdk/unreal_bindings/uobject.h"
@@ -26,6 +30,7 @@ void register_module(py::module_& mod) {
     auto unreal = mod.def_submodule(PYUNREALSDK_STUBGEN_SUBMODULE("unrealsdk", "unreal"));
 
     register_property_helpers(unreal);
+    register_generated_types(unreal);
 
     register_uobject(unreal);
     register_uobject_children(unreal);
@@ -33,6 +38,9 @@ void register_module(py::module_& mod) {
     register_wrapped_array(unreal);
     register_wrapped_struct(unreal);
     register_bound_function(unreal);
+    register_prepared_call(unreal);
+    register_field_accessor(unreal);
+    register_compiled_path(unreal);
     register_weak_pointer(unreal);
     register_persistent_object_properties(unreal);
     register_wrapped_multicast_delegate(unreal);
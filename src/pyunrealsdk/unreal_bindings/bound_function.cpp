@@ -2,12 +2,25 @@
 #include "pyunrealsdk/unreal_bindings/bound_function.h"
 #include "pyunrealsdk/hooks.h"
 #include "pyunrealsdk/stubgen.h"
+#include "pyunrealsdk/unreal_bindings/prepared_call.h"
 #include "pyunrealsdk/unreal_bindings/property_access.h"
 #include "unrealsdk/hook_manager.h"
 #include "unrealsdk/unreal/classes/ufunction.h"
 #include "unrealsdk/unreal/classes/uobject.h"
+#include "unrealsdk/unreal/classes/uscriptstruct.h"
 #include "unrealsdk/unreal/classes/ustruct.h"
+#include "unrealsdk/unreal/cast.h"
+#include "unrealsdk/unreal/properties/copyable_property.h"
+#include "unrealsdk/unreal/properties/zboolproperty.h"
+#include "unrealsdk/unreal/properties/zbyteproperty.h"
+#include "unrealsdk/unreal/properties/zclassproperty.h"
+#include "unrealsdk/unreal/properties/zcomponentproperty.h"
+#include "unrealsdk/unreal/properties/zenumproperty.h"
+#include "unrealsdk/unreal/properties/zinterfaceproperty.h"
+#include "unrealsdk/unreal/properties/zobjectproperty.h"
 #include "unrealsdk/unreal/properties/zproperty.h"
+#include "unrealsdk/unreal/properties/zstructproperty.h"
+#include "unrealsdk/unreal/properties/zweakobjectproperty.h"
 #include "unrealsdk/unreal/structs/fname.h"
 #include "unrealsdk/unreal/wrappers/bound_function.h"
 #include "unrealsdk/unreal/wrappers/wrapped_struct.h"
@@ -50,52 +63,197 @@ namespace {
 }
 
 /**
- * @brief Fills the params struct for a function with args from python.
- * @note While this is similar to `make_struct`, we need to do some extra processing on the params,
- *       and we need to fail if an arg was missed.
+ * @brief Checks if a param can be reset just by zeroing it, i.e. it has nothing to destroy.
+ *
+ * @param prop The param to check.
+ * @param allow_structs True if to allow struct params, if all their fields are also trivial.
+ * @return True if the param is trivial.
+ */
+bool is_trivial_param(const ZProperty* prop, bool allow_structs) {
+    bool trivial = false;
+    cast(prop, [allow_structs, &trivial]<typename T>(const T* prop) {
+        if constexpr (std::is_same_v<T, ZStructProperty>) {
+            if (!allow_structs) {
+                return;
+            }
+            trivial = true;
+            for (auto inner : prop->Struct()->properties()) {
+                if (!is_trivial_param(inner, true)) {
+                    trivial = false;
+                    return;
+                }
+            }
+        } else {
+            trivial = std::is_same_v<T, ZBoolProperty> || std::is_same_v<T, ZByteProperty>
+                      || std::is_same_v<T, ZClassProperty>
+                      || std::is_same_v<T, ZComponentProperty>
+                      || std::is_same_v<T, ZDoubleProperty> || std::is_same_v<T, ZEnumProperty>
+                      || std::is_same_v<T, ZFloatProperty> || std::is_same_v<T, ZInt16Property>
+                      || std::is_same_v<T, ZInt64Property> || std::is_same_v<T, ZInt8Property>
+                      || std::is_same_v<T, ZInterfaceProperty>
+                      || std::is_same_v<T, ZIntProperty> || std::is_same_v<T, ZNameProperty>
+                      || std::is_same_v<T, ZObjectProperty> || std::is_same_v<T, ZUInt16Property>
+                      || std::is_same_v<T, ZUInt32Property> || std::is_same_v<T, ZUInt64Property>
+                      || std::is_same_v<T, ZWeakObjectProperty>;
+        }
+    });
+    return trivial;
+}
+
+// How many calls took each path in `call_bound_function`. Only accessed while holding the GIL.
+struct CallCounts {
+    uint64_t released_gil;
+    uint64_t kept_gil;
+};
+CallCounts call_counts{};
+
+// Functions may get called from any thread, but we only ever access this while holding the GIL
+std::unordered_map<const UFunction*, std::shared_ptr<const impl::CallPlan>> call_plans{};
+
+/**
+ * @brief Checks the positional arg count, and tries to reuse a params struct passed as the args.
  *
  * @param info The call info to write to.
- * @param args The python args.
- * @param kwargs The python kwargs.
+ * @param func The function being called.
+ * @param args The array of positional args.
+ * @param nargs The number of positional args.
+ * @param has_kwargs True if any kwargs were passed.
+ * @return True if a params struct was reused, and the call info is already complete.
  */
-void fill_py_params(impl::PyCallInfo& info, const py::args& args, const py::kwargs& kwargs) {
-    size_t arg_idx = 0;
+bool try_reuse_params_struct(impl::PyCallInfo& info,
+                             const UFunction* func,
+                             PyObject* const* args,
+                             size_t nargs,
+                             bool has_kwargs) {
+    if (func->NumParams() < nargs) {
+        throw py::type_error(std::format("{}() takes {} positional args, but {} were given",
+                                         func->Name(), func->NumParams(), nargs));
+    }
 
-    std::vector<FName> missing_required_args{};
+    // If we're given exactly one arg, and it's a wrapped struct of our function type, take it as
+    // the args directly
+    if (nargs == 1 && !has_kwargs && py::isinstance<WrappedStruct>(args[0])) {
+        auto args_struct = py::cast<WrappedStruct>(args[0]);
+        if (args_struct.type == func) {
+            info.params = std::move(args_struct);
+            return true;
+        }
+    }
 
-    for (auto prop : info.params.type->properties()) {
+    // Otherwise, get a new params struct, reusing an old one if we can
+    auto& pool = info.plan->free_params;
+    if (pool.empty()) {
+        info.params = WrappedStruct{func};
+    } else {
+        info.params = std::move(pool.back());
+        pool.pop_back();
+    }
+    info.recycle_params = info.plan->pool_params;
+    return false;
+}
+
+// Implement calls using native slots, rather than binding `__call__`, so that we can use vectorcall
+// and skip packing args into a tuple/dict. The vectorcall function pointer is stored directly after
+// the standard pybind instance.
+
+PyObject* bound_function_vectorcall(PyObject* callable,
+                                    PyObject* const* args,
+                                    size_t nargsf,
+                                    PyObject* kwnames) {
+    try {
+        auto& self = py::cast<BoundFunction&>(py::handle{callable});
+        impl::PyCallInfo info{self.func, args, static_cast<size_t>(PyVectorcall_NARGS(nargsf)),
+                              kwnames};
+        return impl::call_bound_function(self, info).release().ptr();
+    } catch (...) {
+        py::detail::try_translate_exceptions();
+        return nullptr;
+    }
+}
+
+PyObject* bound_function_call(PyObject* callable, PyObject* args, PyObject* kwargs) {
+    try {
+        auto& self = py::cast<BoundFunction&>(py::handle{callable});
+        impl::PyCallInfo info{self.func, py::reinterpret_borrow<py::args>(args),
+                              kwargs == nullptr ? py::kwargs{}
+                                                : py::reinterpret_borrow<py::kwargs>(kwargs)};
+        return impl::call_bound_function(self, info).release().ptr();
+    } catch (...) {
+        py::detail::try_translate_exceptions();
+        return nullptr;
+    }
+}
+
+PyObject* bound_function_alloc(PyTypeObject* type, Py_ssize_t nitems) {
+    auto self = PyType_GenericAlloc(type, nitems);
+    if (self != nullptr) {
+        *reinterpret_cast<vectorcallfunc*>(reinterpret_cast<uintptr_t>(self)
+                                           + type->tp_vectorcall_offset) =
+            &bound_function_vectorcall;
+    }
+    return self;
+}
+
+/**
+ * @brief Converts the exception currently being handled into a python exception object.
+ * @note Must be called from within a catch block.
+ *
+ * @return The python exception.
+ */
+py::object current_exception_as_py(void) {
+    py::detail::try_translate_exceptions();
+    const py::error_already_set err{};
+    return err.value();
+}
+
+/**
+ * @brief Creates the call info for a single entry of `call_many`.
+ *
+ * @param func The function being called.
+ * @param entry The entry's args. May be a mapping of kwargs, a params struct, or a sequence of
+ *              positional args.
+ * @return The call info.
+ */
+impl::PyCallInfo make_call_many_info(const UFunction* func, const py::handle& entry) {
+    if (py::isinstance<py::dict>(entry)) {
+        return {func, py::args{}, py::reinterpret_borrow<py::kwargs>(entry)};
+    }
+    if (py::isinstance<WrappedStruct>(entry)) {
+        return {func, py::reinterpret_steal<py::args>(py::make_tuple(entry).release()),
+                py::kwargs{}};
+    }
+    return {func, py::reinterpret_steal<py::args>(py::tuple(entry).release()), py::kwargs{}};
+}
+
+}  // namespace
+
+namespace impl {
+
+CallPlan::CallPlan(const UFunction* func)
+    : func_index(func->InternalIndex()), pool_params(true) {
+    for (auto prop : func->properties()) {
         if ((prop->PropertyFlags() & ZProperty::PROP_FLAG_PARAM) == 0) {
             continue;
         }
         if ((prop->PropertyFlags() & ZProperty::PROP_FLAG_RETURN) != 0
-            && info.return_param == nullptr) {
-            info.return_param = prop;
+            && this->return_param.prop == nullptr) {
+            this->return_param = {.prop = prop, .accessors = get_property_accessors(prop)};
+            // Struct return values are returned as a reference into the params struct
+            this->pool_params = this->pool_params && is_trivial_param(prop, false);
             continue;
         }
-        if ((prop->PropertyFlags() & ZProperty::PROP_FLAG_OUT) != 0) {
-            info.out_params.push_back(prop);
-        }
-
-        // If we still have positional args left
-        if (arg_idx != args.size()) {
-            py_setattr_direct(prop, reinterpret_cast<uintptr_t>(info.params.base.get()),
-                              args[arg_idx++]);
 
-            if (kwargs.contains(prop->Name())) {
-                throw py::type_error(std::format("{}() got multiple values for argument '{}'",
-                                                 info.params.type->Name(), prop->Name()));
-            }
-
-            continue;
+        const ParamSlot slot{.prop = prop, .accessors = get_property_accessors(prop)};
+        auto is_out = (prop->PropertyFlags() & ZProperty::PROP_FLAG_OUT) != 0;
+        if (is_out) {
+            this->out_params.push_back(slot);
         }
-        // If we're on to just kwargs
+        this->pool_params = this->pool_params && is_trivial_param(prop, !is_out);
 
-        if (kwargs.contains(prop->Name())) {
-            // Extract the value with pop, so we can check that kwargs are empty at the
-            // end
-            py_setattr_direct(prop, reinterpret_cast<uintptr_t>(info.params.base.get()),
-                              kwargs.attr("pop")(prop->Name()));
-            continue;
+        auto idx = this->params.size();
+        if (idx >= this->required.size()) {
+            throw std::runtime_error(
+                std::format("{}() has too many params to be called from python", func->Name()));
         }
 
         // NOLINTNEXTLINE(misc-const-correctness)
@@ -103,93 +261,300 @@ void fill_py_params(impl::PyCallInfo& info, const py::args& args, const py::kwar
 #if UNREALSDK_HAS_OPTIONAL_FUNC_PARAMS
         optional = (prop->PropertyFlags() & ZProperty::PROP_FLAG_OPTIONAL) != 0;
 #endif
+        this->required.set(idx, !optional);
 
-        // If not given, and not optional, record for error later
-        if (!optional) {
-            missing_required_args.push_back(prop->Name());
-        }
+        this->params.push_back(slot);
+        this->param_slots.emplace(std::string{prop->Name()}, idx);
+    }
+
+    if (this->pool_params) {
+        // Reserve up front, so that giving a struct back to the pool never needs to allocate
+        this->free_params.reserve(MAX_POOLED_PARAMS);
+    }
+}
+
+std::shared_ptr<const CallPlan> CallPlan::get(const UFunction* func) {
+    auto iter = call_plans.find(func);
+    if (iter != call_plans.end() && iter->second->func_index == func->InternalIndex()) {
+        return iter->second;
+    }
+
+    auto plan = std::make_shared<const CallPlan>(func);
+    call_plans.insert_or_assign(func, plan);
+    return plan;
+}
+
+ParamBinder::ParamBinder(const WrappedStruct& params,
+                         const CallPlan& plan,
+                         const CallPlan::ParamMask& already_given)
+    : params(params),
+      plan(plan),
+      base_addr(reinterpret_cast<uintptr_t>(params.base.get())),
+      given(already_given) {}
+
+const CallPlan::ParamMask& ParamBinder::given_params(void) const {
+    return this->given;
+}
+
+void ParamBinder::positional(PyObject* const* args, size_t nargs) {
+    // Any extra positional args beyond the params are ignored
+    auto num_positional = std::min(nargs, this->plan.params.size());
+    for (size_t i = 0; i < num_positional; i++) {
+        this->slot(i, args[i]);
     }
+}
 
-    if (!missing_required_args.empty()) {
-        throw_missing_required_args(info.params.type->Name(), missing_required_args);
+void ParamBinder::slot(size_t idx, PyObject* value) {
+    const auto& slot = this->plan.params[idx];
+    if (this->given.test(idx)) {
+        throw py::type_error(std::format("{}() got multiple values for argument '{}'",
+                                         this->params.type->Name(), slot.prop->Name()));
     }
 
-    if (!kwargs.empty()) {
-        // Copying python, we only need to warn about one extra kwarg
-        std::string bad_kwarg = py::str(kwargs.begin()->first);
+    slot.accessors.set(slot.prop, this->base_addr, py::reinterpret_borrow<py::object>(value));
+    this->given.set(idx);
+}
+
+void ParamBinder::keyword(PyObject* key, PyObject* value) {
+    py::ssize_t size = 0;
+    const char* str = PyUnicode_AsUTF8AndSize(key, &size);
+    if (str == nullptr) {
+        PyErr_Clear();
+        throw py::type_error(
+            std::format("{}() keywords must be strings", this->params.type->Name()));
+    }
+
+    const std::string name{str, static_cast<size_t>(size)};
+    auto iter = this->plan.param_slots.find(name);
+    if (iter == this->plan.param_slots.end()) {
         throw py::type_error(std::format("{}() got an unexpected keyword argument '{}'",
-                                         info.params.type->Name(), bad_kwarg));
+                                         this->params.type->Name(), name));
     }
+
+    this->slot(iter->second, value);
 }
 
-}  // namespace
+void ParamBinder::finish(void) const {
+    auto missing = this->plan.required & ~this->given;
+    if (missing.none()) {
+        return;
+    }
 
-namespace impl {
+    std::vector<FName> missing_required_args{};
+    for (size_t i = 0; i < this->plan.params.size(); i++) {
+        if (missing.test(i)) {
+            missing_required_args.push_back(this->plan.params[i].prop->Name());
+        }
+    }
+    throw_missing_required_args(this->params.type->Name(), missing_required_args);
+}
+
+PyCallInfo::PyCallInfo(const UFunction* func) : params(func), plan(CallPlan::get(func)) {}
 
 PyCallInfo::PyCallInfo(const UFunction* func, const py::args& args, const py::kwargs& kwargs)
     // Start by initializing a null struct, to avoid allocations
-    : params(func, nullptr) {
-    if (func->NumParams() < args.size()) {
-        throw py::type_error(std::format("{}() takes {} positional args, but {} were given",
-                                         func->Name(), func->NumParams(), args.size()));
+    : params(func, nullptr), plan(CallPlan::get(func)) {
+    auto args_array = &PyTuple_GET_ITEM(args.ptr(), 0);
+    if (try_reuse_params_struct(*this, func, args_array, args.size(), !kwargs.empty())) {
+        return;
     }
 
-    // If we're given exactly one arg, and it's a wrapped struct of our function type, take it as
-    // the args directly
-    if (args.size() == 1 && kwargs.empty() && py::isinstance<WrappedStruct>(args[0])) {
-        auto args_struct = py::cast<WrappedStruct>(args[0]);
-        if (args_struct.type == func) {
-            this->params = std::move(args_struct);
-
-            // Manually gather the return value and out params
-            for (auto prop : func->properties()) {
-                if ((prop->PropertyFlags() & ZProperty::PROP_FLAG_RETURN) != 0
-                    && return_param == nullptr) {
-                    this->return_param = prop;
-                    continue;
-                }
-                if ((prop->PropertyFlags() & ZProperty::PROP_FLAG_OUT) != 0) {
-                    this->out_params.push_back(prop);
-                }
-            }
-            return;
-        }
+    ParamBinder binder{this->params, *this->plan};
+    binder.positional(args_array, args.size());
+    for (const auto& [key, value] : kwargs) {
+        binder.keyword(key.ptr(), value.ptr());
+    }
+    binder.finish();
+}
+
+PyCallInfo::PyCallInfo(const UFunction* func,
+                       PyObject* const* args,
+                       size_t nargs,
+                       PyObject* kwnames)
+    : params(func, nullptr), plan(CallPlan::get(func)) {
+    auto nkwargs = kwnames == nullptr ? 0 : static_cast<size_t>(PyTuple_GET_SIZE(kwnames));
+    if (try_reuse_params_struct(*this, func, args, nargs, nkwargs != 0)) {
+        return;
     }
 
-    // Otherwise, allocate a new params struct
-    this->params = WrappedStruct{func};
-    fill_py_params(*this, args, kwargs);
+    ParamBinder binder{this->params, *this->plan};
+    binder.positional(args, nargs);
+    // The kwarg values come straight after the positional args
+    for (size_t i = 0; i < nkwargs; i++) {
+        binder.keyword(PyTuple_GET_ITEM(kwnames, i), args[nargs + i]);
+    }
+    binder.finish();
+}
+
+PyCallInfo::PyCallInfo(const PyCallInfo& other) : params(other.params), plan(other.plan) {}
+
+PyCallInfo::PyCallInfo(PyCallInfo&& other) noexcept
+    : params(std::move(other.params)),
+      plan(std::move(other.plan)),
+      recycle_params(std::exchange(other.recycle_params, false)) {}
+
+PyCallInfo::~PyCallInfo() {
+    if (!this->recycle_params || this->params.base.get() == nullptr) {
+        return;
+    }
+
+    auto& pool = this->plan->free_params;
+    if (pool.size() >= CallPlan::MAX_POOLED_PARAMS) {
+        return;
+    }
+
+    // Since all params are trivial, zeroing is equivalent to destroying and recreating the struct
+    memset(this->params.base.get(), 0, this->params.type->get_struct_size());
+    pool.push_back(std::move(this->params));
 }
 
 py::object PyCallInfo::get_py_return(void) const {
-    const py::list ret{1 + this->out_params.size()};
+    auto base_addr = reinterpret_cast<uintptr_t>(this->params.base.get());
 
-    if (this->return_param == nullptr) {
-        ret[0] = py::ellipsis{};
-    } else {
-        ret[0] =
-            py_getattr(this->return_param, reinterpret_cast<uintptr_t>(this->params.base.get()),
-                       this->params.base);
+    const auto& return_param = this->plan->return_param;
+    py::object ret_val = py::ellipsis{};
+    if (return_param.prop != nullptr) {
+        ret_val = return_param.accessors.get(return_param.prop, base_addr, this->params.base);
+    }
+
+    const auto& out_params = this->plan->out_params;
+    if (out_params.empty()) {
+        return ret_val;
     }
 
-    auto idx = 1;
-    for (auto prop : this->out_params) {
-        ret[idx++] = py_getattr(prop, reinterpret_cast<uintptr_t>(this->params.base.get()),
-                                this->params.base);
+    py::tuple ret{1 + out_params.size()};
+    ret[0] = std::move(ret_val);
+    for (size_t i = 0; i < out_params.size(); i++) {
+        const auto& slot = out_params[i];
+        ret[i + 1] = slot.accessors.get(slot.prop, base_addr, this->params.base);
+    }
+    return ret;
+}
+
+py::object call_bound_function(BoundFunction& self, PyCallInfo& info) {
+    if (hooks::should_auto_inject_py_calls()) {
+        unrealsdk::hook_manager::inject_next_call();
     }
 
-    if (this->out_params.empty()) {
-        return ret[0];
+    // Release the GIL to avoid a deadlock if ProcessEvent is locking.
+    // If a hook tries to call into Python, it will be holding the process event lock, and it will
+    // try to acquire the GIL.
+    // If at the same time python code on a different thread tries to call an unreal function,
+    // it'd be holding the GIL, and trying to acquire the process event lock.
+    // If we're already inside a hook on this thread however, we either already hold the (recursive)
+    // process event lock, or it's not enabled, so we can't deadlock, and can skip the release.
+    if (hooks::is_in_hook()) {
+        call_counts.kept_gil++;
+        self.call<void>(info.params);
+    } else {
+        call_counts.released_gil++;
+        const py::gil_scoped_release gil{};
+        self.call<void>(info.params);
     }
-    return py::tuple(ret);
+
+    return info.get_py_return();
 }
 
 }  // namespace impl
 
+py::list call_many(UFunction* func, const py::sequence& objects, const py::object& args) {
+    if (func == nullptr) {
+        throw std::invalid_argument("Passed function was null!");
+    }
+
+    auto num_objects = objects.size();
+
+    // A single struct gets reused for every object, anything else should have one entry per object
+    py::object shared_args{};
+    py::sequence per_object_args{};
+    if (py::isinstance<WrappedStruct>(args)) {
+        if (py::cast<const WrappedStruct&>(args).type != func) {
+            throw py::type_error(
+                std::format("params struct is not of the correct type for {}()", func->Name()));
+        }
+        shared_args = args;
+    } else {
+        per_object_args = py::list(args);
+        if (per_object_args.size() != num_objects) {
+            throw py::value_error(std::format("got {} objects, but {} sets of args",
+                                              num_objects, per_object_args.size()));
+        }
+    }
+
+    py::list results{num_objects};
+
+    // Convert everything up front, while we still have the GIL
+    std::vector<UObject*> call_objects(num_objects, nullptr);
+    std::vector<std::optional<impl::PyCallInfo>> infos(num_objects);
+    for (size_t i = 0; i < num_objects; i++) {
+        try {
+            auto obj = py::cast<UObject*>(objects[i]);
+            if (obj == nullptr) {
+                throw py::type_error(std::format("cannot call {}() on None", func->Name()));
+            }
+
+            infos[i].emplace(make_call_many_info(
+                func, shared_args ? py::handle{shared_args} : py::handle{per_object_args[i]}));
+            call_objects[i] = obj;
+        } catch (...) {
+            results[i] = current_exception_as_py();
+        }
+    }
+
+    auto inject = hooks::should_auto_inject_py_calls();
+    std::vector<std::exception_ptr> call_errors(num_objects);
+
+    // Release the GIL once for the whole batch - see the comment in `call_bound_function`
+    {
+        const py::gil_scoped_release gil{};
+
+        for (size_t i = 0; i < num_objects; i++) {
+            if (!infos[i].has_value()) {
+                continue;
+            }
+
+            try {
+                if (inject) {
+                    unrealsdk::hook_manager::inject_next_call();
+                }
+                BoundFunction{func, call_objects[i]}.call<void>(infos[i]->params);
+            } catch (...) {
+                call_errors[i] = std::current_exception();
+            }
+        }
+    }
+
+    for (size_t i = 0; i < num_objects; i++) {
+        if (!infos[i].has_value()) {
+            continue;
+        }
+
+        try {
+            if (call_errors[i]) {
+                std::rethrow_exception(call_errors[i]);
+            }
+            results[i] = infos[i]->get_py_return();
+        } catch (...) {
+            results[i] = current_exception_as_py();
+        }
+    }
+
+    return results;
+}
+
 void register_bound_function(py::module_& mod) {
     PYUNREALSDK_STUBGEN_MODULE_N("unrealsdk.unreal")
 
-    py::classh<BoundFunction>(mod, PYUNREALSDK_STUBGEN_CLASS("BoundFunction", ))
+    py::classh<BoundFunction>(
+        mod, PYUNREALSDK_STUBGEN_CLASS("BoundFunction", ),
+        py::custom_type_setup([](PyHeapTypeObject* heap_type) {
+            auto type = &heap_type->ht_type;
+            type->tp_vectorcall_offset = type->tp_basicsize;
+            type->tp_basicsize += sizeof(vectorcallfunc);
+            type->tp_flags |= Py_TPFLAGS_HAVE_VECTORCALL;
+            type->tp_alloc = &bound_function_alloc;
+            type->tp_call = &bound_function_call;
+        }))
         .def(py::init<UFunction*, UObject*>() PYUNREALSDK_STUBGEN_METHOD_N("__init__", "None"),
              PYUNREALSDK_STUBGEN_DOCSTRING("Creates a new bound function.\n"
                                            "\n"
@@ -210,27 +575,49 @@ void register_bound_function(py::module_& mod) {
                 "Returns:\n"
                 "    The string representation.\n"))
         .def(
-            // HACK: include the noqa in the return value. This gives us an extra colon but meh.
-            PYUNREALSDK_STUBGEN_METHOD("__call__", "Any:  # noqa: D417 "),
-            [](BoundFunction& self, const py::args& args, const py::kwargs& kwargs) {
-                impl::PyCallInfo info{self.func, args, kwargs};
-
-                if (hooks::should_auto_inject_py_calls()) {
-                    unrealsdk::hook_manager::inject_next_call();
-                }
-
-                // Release the GIL to avoid a deadlock if ProcessEvent is locking.
-                // If a hook tries to call into Python, it will be holding the process event lock,
-                // and it will try to acquire the GIL.
-                // If at the same time python code on a different thread tries to call an unreal
-                // function, it'd be holding the GIL, and trying to acquire the process event lock.
-                {
-                    const py::gil_scoped_release gil{};
-                    self.call<void>(info.params);
-                }
-
-                return info.get_py_return();
+            PYUNREALSDK_STUBGEN_METHOD("prepare", "PreparedCall"),
+            [](const BoundFunction& self, const py::kwargs& fixed_args) {
+                return PreparedCall{self, fixed_args};
             },
+            PYUNREALSDK_STUBGEN_DOCSTRING(
+                "Prepares a reusable call to this function, with some args fixed.\n"
+                "\n"
+                "Useful when repeatedly calling the same function with only a few args\n"
+                "changing, since the fixed args only get converted once, and the same params\n"
+                "struct is reused for every call.\n"
+                "\n"
+                "Args:\n"
+                "    **fixed_args: The args to use on every call, by name.\n"
+                "Returns:\n"
+                "    A new prepared call.\n")
+                PYUNREALSDK_STUBGEN_ARG_N("**fixed_args"_a, "Any", ))
+        .def_static(
+            PYUNREALSDK_STUBGEN_STATICMETHOD("_get_call_counts", "dict[str, int]"),
+            []() {
+                py::dict counts{};
+                counts["released_gil"] = call_counts.released_gil;
+                counts["kept_gil"] = call_counts.kept_gil;
+                return counts;
+            },
+            PYUNREALSDK_STUBGEN_DOCSTRING(
+                "Gets how many bound function calls took each GIL handling path.\n"
+                "\n"
+                "Calls made from inside a hook don't need to release the GIL, since they can't\n"
+                "deadlock against the process event lock.\n"
+                "\n"
+                "Returns:\n"
+                "    A dict with the number of calls which released the GIL, and the number\n"
+                "    which kept holding it.\n"))
+        .def_static(
+            PYUNREALSDK_STUBGEN_STATICMETHOD("_reset_call_counts", "None"),
+            []() { call_counts = CallCounts{}; },
+            PYUNREALSDK_STUBGEN_DOCSTRING("Resets the counts returned by _get_call_counts().\n"))
+        .def_readwrite(PYUNREALSDK_STUBGEN_ATTR("func", "UFunction"), &BoundFunction::func)
+        .def_readwrite(PYUNREALSDK_STUBGEN_ATTR("object", "UObject"), &BoundFunction::object);
+
+    // The call slots are set above, this is just for the stubs
+    // HACK: include the noqa in the return value. This gives us an extra colon but meh.
+    PYUNREALSDK_STUBGEN_METHOD_N("__call__", "Any:  # noqa: D417 ")
 #if UNREALSDK_HAS_OPTIONAL_FUNC_PARAMS
     // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define OPTIONAL_FUNC_PARAMS_DOC " Optional params are also optional."
@@ -238,25 +625,23 @@ void register_bound_function(py::module_& mod) {
     // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define OPTIONAL_FUNC_PARAMS_DOC
 #endif
-            PYUNREALSDK_STUBGEN_DOCSTRING(
-                "Calls the function.\n"
-                "\n"
-                "Args:\n"
-                "    The unreal function's args. Out params will be used to initialized the\n"
-                "    unreal value, but the python value is not modified in place. Kwargs are\n"
-                "    supported." OPTIONAL_FUNC_PARAMS_DOC "\n"
-                "    Alternatively, may call with a single positional WrappedStruct which matches\n"
-                "    the type of the function, in order to reuse the args already stored in it.\n"
-                "Returns:\n"
-                "    If the function has no out params, returns the actual return value, or\n"
-                "    Ellipsis for a void function.\n"
-                "    If there are out params, returns a tuple, where the first entry is the\n"
-                "    return value as described above, and the following entries are the final\n"
-                "    values of each of the out params, in positional order.\n")
-                PYUNREALSDK_STUBGEN_ARG_N("*args"_a, "Any", )
-                    PYUNREALSDK_STUBGEN_ARG_N("**kwargs"_a, "Any", ))
-        .def_readwrite(PYUNREALSDK_STUBGEN_ATTR("func", "UFunction"), &BoundFunction::func)
-        .def_readwrite(PYUNREALSDK_STUBGEN_ATTR("object", "UObject"), &BoundFunction::object);
+    PYUNREALSDK_STUBGEN_DOCSTRING_N(
+        "Calls the function.\n"
+        "\n"
+        "Args:\n"
+        "    The unreal function's args. Out params will be used to initialized the\n"
+        "    unreal value, but the python value is not modified in place. Kwargs are\n"
+        "    supported." OPTIONAL_FUNC_PARAMS_DOC "\n"
+        "    Alternatively, may call with a single positional WrappedStruct which matches\n"
+        "    the type of the function, in order to reuse the args already stored in it.\n"
+        "Returns:\n"
+        "    If the function has no out params, returns the actual return value, or\n"
+        "    Ellipsis for a void function.\n"
+        "    If there are out params, returns a tuple, where the first entry is the\n"
+        "    return value as described above, and the following entries are the final\n"
+        "    values of each of the out params, in positional order.\n")
+    PYUNREALSDK_STUBGEN_ARG_N("*args"_a, "Any", )
+    PYUNREALSDK_STUBGEN_ARG_N("**kwargs"_a, "Any", )
 }
 
 }  // namespace pyunrealsdk::unreal
@@ -2,6 +2,9 @@
 #define PYUNREALSDK_UNREAL_BINDINGS_BOUND_FUNCTION_H
 
 #include "pyunrealsdk/pch.h"
+#include "pyunrealsdk/unreal_bindings/property_access.h"
+#include "unrealsdk/unreal/structs/fname.h"
+#include "unrealsdk/unreal/wrappers/bound_function.h"
 #include "unrealsdk/unreal/wrappers/wrapped_struct.h"
 
 #ifdef PYUNREALSDK_INTERNAL
@@ -17,11 +20,126 @@ namespace pyunrealsdk::unreal {
 
 namespace impl {
 
+// Everything needed to convert a python call into an unreal one, worked out once per function.
+struct CallPlan {
+    // One bit per param slot. Unreal stores the param count as a byte, so this covers them all.
+    using ParamMask = std::bitset<std::numeric_limits<uint8_t>::max() + 1>;
+
+    struct ParamSlot {
+        unrealsdk::unreal::ZProperty* prop{};
+        PropertyAccessors accessors{};
+    };
+
+    // The non-return params, in positional order
+    std::vector<ParamSlot> params;
+    // Maps param names to their index in the above. Keyed on the plain string, so that kwargs are
+    // matched case-sensitively, same as any other python function.
+    std::unordered_map<std::string, size_t> param_slots;
+    // Which of the params must be given
+    ParamMask required;
+
+    // The prop is null for void functions
+    ParamSlot return_param;
+    std::vector<ParamSlot> out_params;
+
+    // Used to detect if the function got unloaded, and something else took it's place
+    int32_t func_index;
+
+    // The most params structs we'll keep around for reuse
+    static constexpr size_t MAX_POOLED_PARAMS = 8;
+
+    // True if params structs may be reused between calls. This requires every param to be safe to
+    // reset just by zeroing it, and that none of the return values keep a reference to the struct.
+    bool pool_params;
+    // Zeroed params structs ready for reuse. Only accessed while holding the GIL.
+    mutable std::vector<unrealsdk::unreal::WrappedStruct> free_params;
+
+    /**
+     * @brief Works out the call plan for a function.
+     *
+     * @param func The function to create the plan for.
+     */
+    CallPlan(const unrealsdk::unreal::UFunction* func);
+
+    /**
+     * @brief Gets the call plan for a function, creating it on first use.
+     *
+     * @param func The function to get the plan for.
+     * @return The call plan.
+     */
+    static std::shared_ptr<const CallPlan> get(const unrealsdk::unreal::UFunction* func);
+};
+
+// Helper which fills a params struct with args from python.
+class ParamBinder {
+   private:
+    const unrealsdk::unreal::WrappedStruct& params;
+    const CallPlan& plan;
+    uintptr_t base_addr;
+    CallPlan::ParamMask given;
+
+   public:
+    /**
+     * @brief Creates a new binder.
+     *
+     * @param params The params struct to write to.
+     * @param plan The call plan of the function being called.
+     * @param already_given Any params which should be treated as already given.
+     */
+    ParamBinder(const unrealsdk::unreal::WrappedStruct& params,
+                const CallPlan& plan,
+                const CallPlan::ParamMask& already_given = {});
+
+    /**
+     * @brief Gets which params have been given so far.
+     *
+     * @return A mask of the given params.
+     */
+    [[nodiscard]] const CallPlan::ParamMask& given_params(void) const;
+
+    /**
+     * @brief Binds the positional args.
+     *
+     * @param args The array of positional args.
+     * @param nargs The number of positional args.
+     */
+    void positional(PyObject* const* args, size_t nargs);
+
+    /**
+     * @brief Binds a single param, by it's index in the call plan.
+     *
+     * @param idx The index of the param.
+     * @param value The value of the param.
+     */
+    void slot(size_t idx, PyObject* value);
+
+    /**
+     * @brief Binds a single keyword arg.
+     *
+     * @param key The name of the arg.
+     * @param value The value of the arg.
+     */
+    void keyword(PyObject* key, PyObject* value);
+
+    /**
+     * @brief Checks that all required args were bound, throwing if not.
+     */
+    void finish(void) const;
+};
+
 // Type helping convert a python function call to an unreal one.
 struct PyCallInfo {
     unrealsdk::unreal::WrappedStruct params;
-    unrealsdk::unreal::ZProperty* return_param{};
-    std::vector<unrealsdk::unreal::ZProperty*> out_params;
+    std::shared_ptr<const CallPlan> plan;
+    // True if the params struct should be given back to the plan's pool once we're done with it
+    bool recycle_params = false;
+
+    /**
+     * @brief Creates a call info with a default initialized params struct.
+     *
+     * @param func The function being called.
+     */
+    PyCallInfo(const unrealsdk::unreal::UFunction* func);
 
     /**
      * @brief Converts python args into a params struct.
@@ -34,6 +152,26 @@ struct PyCallInfo {
                const py::args& args,
                const py::kwargs& kwargs);
 
+    /**
+     * @brief Converts python args, in vectorcall form, into a params struct.
+     *
+     * @param func The function being called.
+     * @param args The array of positional args, followed by the values of the kwargs.
+     * @param nargs The number of positional args.
+     * @param kwnames A tuple of the kwarg names, or nullptr if there are none.
+     */
+    PyCallInfo(const unrealsdk::unreal::UFunction* func,
+               PyObject* const* args,
+               size_t nargs,
+               PyObject* kwnames);
+
+    // Copies never recycle their params, only the original does
+    PyCallInfo(const PyCallInfo& other);
+    PyCallInfo(PyCallInfo&& other) noexcept;
+    PyCallInfo& operator=(const PyCallInfo&) = delete;
+    PyCallInfo& operator=(PyCallInfo&&) = delete;
+    ~PyCallInfo();
+
     /**
      * @brief Get the python return value for the function call from the contained params struct.
      *
@@ -42,8 +180,29 @@ struct PyCallInfo {
     [[nodiscard]] py::object get_py_return(void) const;
 };
 
+/**
+ * @brief Calls a bound function, using the given call info.
+ *
+ * @param self The bound function to call.
+ * @param info The call info holding the filled params struct.
+ * @return The value to return to python.
+ */
+py::object call_bound_function(unrealsdk::unreal::BoundFunction& self, PyCallInfo& info);
+
 }  // namespace impl
 
+/**
+ * @brief Calls a function on many objects, only releasing the GIL once for the whole batch.
+ *
+ * @param func The function to call.
+ * @param objects The objects to call it on.
+ * @param args Either a params struct to use for every call, or an iterable of per-object args.
+ * @return A list of the return values, or of the exception raised, for each object.
+ */
+py::list call_many(unrealsdk::unreal::UFunction* func,
+                   const py::sequence& objects,
+                   const py::object& args);
+
 /**
  * @brief Registers BoundFunction.
  *
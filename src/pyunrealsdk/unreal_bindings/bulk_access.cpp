@@ -0,0 +1,270 @@
+#include "pyunrealsdk/pch.h"
+#include "pyunrealsdk/unreal_bindings/bulk_access.h"
+#include "pyunrealsdk/stubgen.h"
+#include "pyunrealsdk/unreal_bindings/property_access.h"
+#include "pyunrealsdk/unreal_bindings/uobject.h"
+#include "unrealsdk/unreal/cast.h"
+#include "unrealsdk/unreal/classes/uclass.h"
+#include "unrealsdk/unreal/classes/uenum.h"
+#include "unrealsdk/unreal/classes/uobject.h"
+#include "unrealsdk/unreal/prop_traits.h"
+#include "unrealsdk/unreal/properties/zproperty.h"
+#include "unrealsdk/unreal/structs/fname.h"
+
+#ifdef PYUNREALSDK_INTERNAL
+
+using namespace unrealsdk::unreal;
+
+namespace pyunrealsdk::unreal {
+
+namespace {
+
+// A field given either by name, or directly
+using FieldArg = std::variant<PyFieldVariant::from_py_type, FName>;
+
+// A property and the base address to read it from
+using PropTarget = std::pair<ZProperty*, uintptr_t>;
+
+/**
+ * @brief Helper to resolve the field argument against each object in turn.
+ * @note Names are looked up on each object's class, only redoing the lookup when it changes from
+ *       the previous object. Fields given directly are not validated, same as `_get_field`.
+ */
+class FieldResolver {
+   private:
+    std::optional<FName> name;
+    const UStruct* last_type = nullptr;
+    ResolvedField field;
+
+   public:
+    /**
+     * @brief Creates a new resolver.
+     *
+     * @param arg The field argument to resolve.
+     */
+    FieldResolver(const FieldArg& arg) {
+        if (std::holds_alternative<FName>(arg)) {
+            this->name = std::get<FName>(arg);
+            return;
+        }
+
+        this->field = resolve_field(PyFieldVariant{std::get<PyFieldVariant::from_py_type>(arg)});
+        if (this->field.kind == FieldKind::MISSING) {
+            throw py::attribute_error("cannot access null attribute");
+        }
+    }
+
+    /**
+     * @brief Resolves the field on the given object.
+     *
+     * @param obj The object to resolve on.
+     * @return The resolved field.
+     */
+    const ResolvedField& resolve(const UObject* obj) {
+        if (this->name.has_value()) {
+            auto type = obj->Class();
+            if (type != this->last_type) {
+                this->field = py_find_field(*this->name, type);
+                this->last_type = type;
+            }
+        }
+        return this->field;
+    }
+};
+
+/**
+ * @brief Gets an object out of the objects sequence, ensuring it's not null.
+ *
+ * @param objects The sequence of objects.
+ * @param idx The index to get.
+ * @return The object.
+ */
+UObject* get_object(const py::sequence& objects, size_t idx) {
+    auto obj = py::cast<UObject*>(objects[idx]);
+    if (obj == nullptr) {
+        throw py::value_error(std::format("object at index {} is None", idx));
+    }
+    return obj;
+}
+
+/**
+ * @brief Reads a primitive property off of all targets, into a buffer.
+ *
+ * @tparam T The property type.
+ * @param targets The properties, and base addresses to read them from. All the properties must be
+ *                of type T.
+ * @return A memoryview over the read values.
+ */
+template <typename T>
+py::object gather_buffer_typed(const std::vector<PropTarget>& targets) {
+    using value_type = PropTraits<T>::Value;
+
+    if constexpr (!std::is_arithmetic_v<value_type>) {
+        throw py::type_error(
+            std::format("cannot gather {} into a buffer, only primitive properties are supported",
+                        targets.front().first->Class()->Name()));
+    } else {
+        // Multiple property types expose a get enum method
+        constexpr bool is_enum = requires(T* type) {
+            { type->Enum() } -> std::convertible_to<UEnum*>;
+        };
+
+        // Validate everything first, so we don't need to throw away a half written buffer
+        for (const auto& [prop, base_addr] : targets) {
+            if (prop->ArrayDim() != 1) {
+                throw py::type_error(std::format(
+                    "cannot gather fixed array '{}' into a buffer, use a list instead",
+                    prop->Name()));
+            }
+            if constexpr (is_enum) {
+                if (static_cast<const T*>(prop)->Enum() != nullptr) {
+                    throw py::type_error(std::format(
+                        "cannot gather enum '{}' into a buffer, use a list instead", prop->Name()));
+                }
+            }
+        }
+
+        // Passing a null pointer allocates without initializing
+        py::bytearray data{nullptr, targets.size() * sizeof(value_type)};
+        char* out = PyByteArray_AsString(data.ptr());
+        for (const auto& [prop, base_addr] : targets) {
+            const value_type val = get_property<T>(static_cast<const T*>(prop), 0, base_addr);
+            std::memcpy(out, &val, sizeof(val));
+            out += sizeof(val);
+        }
+
+        return py::memoryview(data).attr("cast")(py::format_descriptor<value_type>::format());
+    }
+}
+
+/**
+ * @brief Reads a field off of all objects, into a buffer.
+ *
+ * @param objects The sequence of objects.
+ * @param resolver The field resolver.
+ * @return A memoryview over the read values.
+ */
+py::object gather_buffer(const py::sequence& objects, FieldResolver& resolver) {
+    const size_t size = objects.size();
+    if (size == 0) {
+        return py::memoryview(py::bytearray{});
+    }
+
+    // Resolve everything upfront, since we need to know the type before we can create the buffer
+    std::vector<PropTarget> targets{};
+    targets.reserve(size);
+    for (size_t i = 0; i < size; i++) {
+        auto obj = get_object(objects, i);
+        const auto& field = resolver.resolve(obj);
+        if (field.kind != FieldKind::PROPERTY) {
+            throw py::type_error(std::format(
+                "cannot gather '{}' into a buffer, it's not a property", field.field->Name()));
+        }
+        if (!targets.empty() && field.prop->Class() != targets.front().first->Class()) {
+            throw py::type_error(std::format(
+                "cannot gather '{}' into a buffer, it has mixed types", field.prop->Name()));
+        }
+        targets.emplace_back(field.prop, reinterpret_cast<uintptr_t>(obj));
+    }
+
+    py::object ret;
+    cast(targets.front().first, [&ret, &targets]<typename T>(const T* /*prop*/) {
+        ret = gather_buffer_typed<T>(targets);
+    });
+    return ret;
+}
+
+}  // namespace
+
+void register_bulk_access(py::module_& mod) {
+    PYUNREALSDK_STUBGEN_MODULE_N("unrealsdk")
+
+    mod.def(
+        PYUNREALSDK_STUBGEN_FUNC("gather", "list[Any] | memoryview"),
+        [](const py::sequence& objects, const FieldArg& field, bool as_buffer) -> py::object {
+            FieldResolver resolver{field};
+
+            if (as_buffer) {
+                return gather_buffer(objects, resolver);
+            }
+
+            const size_t size = objects.size();
+            py::list ret{size};
+            for (size_t i = 0; i < size; i++) {
+                auto obj = get_object(objects, i);
+                ret[i] = py_getattr(resolver.resolve(obj), reinterpret_cast<uintptr_t>(obj),
+                                    nullptr, obj);
+            }
+            return ret;
+        },
+        PYUNREALSDK_STUBGEN_DOCSTRING(
+            "Reads the same unreal field off of many objects.\n"
+            "\n"
+            "Equivalent to [getattr(obj, field) for obj in objects], but only looks up the\n"
+            "field once per class, and does the entire loop in C++.\n"
+            "\n"
+            "If given a field rather than a name, it is not validated, same as\n"
+            "UObject._get_field().\n"
+            "\n"
+            "Args:\n"
+            "    objects: The objects to read from.\n"
+            "    field: The name of the field to get, or the field itself.\n"
+            "    as_buffer: If true, returns a memoryview over the raw values rather than a list.\n"
+            "               Only supported on primitive (numeric or bool) properties.\n"
+            "Returns:\n"
+            "    A list of the field's value on each object, or a memoryview over them.\n"),
+        PYUNREALSDK_STUBGEN_ARG("objects"_a, "Sequence[UObject]", ),
+#if UNREALSDK_PROPERTIES_ARE_FFIELD
+        PYUNREALSDK_STUBGEN_ARG("field"_a, "str | UField | ZProperty", ),
+#else
+        PYUNREALSDK_STUBGEN_ARG("field"_a, "str | UField", ),
+#endif
+        PYUNREALSDK_STUBGEN_ARG("as_buffer"_a, "bool", "False") = false);
+
+    mod.def(
+        PYUNREALSDK_STUBGEN_FUNC("scatter", "None"),
+        [](const py::sequence& objects, const FieldArg& field, const py::sequence& values) {
+            const size_t size = objects.size();
+            if (values.size() != size) {
+                throw py::value_error(
+                    std::format("got {} values to write to {} objects", values.size(), size));
+            }
+
+            FieldResolver resolver{field};
+            const bool notify = should_notify_changes();
+
+            for (size_t i = 0; i < size; i++) {
+                auto obj = get_object(objects, i);
+                const auto& resolved = resolver.resolve(obj);
+                py_setattr_direct(resolved, reinterpret_cast<uintptr_t>(obj), values[i]);
+
+                if (notify && resolved.kind == FieldKind::PROPERTY) {
+                    obj->post_edit_change_property(resolved.prop);
+                }
+            }
+        },
+        PYUNREALSDK_STUBGEN_DOCSTRING(
+            "Writes the same unreal field on many objects.\n"
+            "\n"
+            "Equivalent to setattr(obj, field, val) for each pair of object and value, but only\n"
+            "looks up the field once per class, and does the entire loop in C++.\n"
+            "\n"
+            "If given a field rather than a name, it is not validated, same as\n"
+            "UObject._set_field().\n"
+            "\n"
+            "Args:\n"
+            "    objects: The objects to write to.\n"
+            "    field: The name of the field to set, or the field itself.\n"
+            "    values: The values to write, one per object.\n"),
+        PYUNREALSDK_STUBGEN_ARG("objects"_a, "Sequence[UObject]", ),
+#if UNREALSDK_PROPERTIES_ARE_FFIELD
+        PYUNREALSDK_STUBGEN_ARG("field"_a, "str | UField | ZProperty", ),
+#else
+        PYUNREALSDK_STUBGEN_ARG("field"_a, "str | UField", ),
+#endif
+        PYUNREALSDK_STUBGEN_ARG("values"_a, "Sequence[Any]", ));
+}
+
+}  // namespace pyunrealsdk::unreal
+
+#endif
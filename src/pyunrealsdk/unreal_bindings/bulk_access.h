@@ -0,0 +1,21 @@
+#ifndef PYUNREALSDK_UNREAL_BINDINGS_BULK_ACCESS_H
+#define PYUNREALSDK_UNREAL_BINDINGS_BULK_ACCESS_H
+
+#include "pyunrealsdk/pch.h"
+
+#ifdef PYUNREALSDK_INTERNAL
+
+namespace pyunrealsdk::unreal {
+
+/**
+ * @brief Registers the bulk field access functions.
+ *
+ * @param mod The module to register within.
+ */
+void register_bulk_access(py::module_& mod);
+
+}  // namespace pyunrealsdk::unreal
+
+#endif
+
+#endif /* PYUNREALSDK_UNREAL_BINDINGS_BULK_ACCESS_H */
@@ -0,0 +1,188 @@
+#include "pyunrealsdk/pch.h"
+#include "pyunrealsdk/unreal_bindings/compiled_path.h"
+#include "pyunrealsdk/stubgen.h"
+#include "pyunrealsdk/unreal_bindings/property_access.h"
+#include "unrealsdk/unreal/cast.h"
+#include "unrealsdk/unreal/classes/uclass.h"
+#include "unrealsdk/unreal/classes/uobject.h"
+#include "unrealsdk/unreal/classes/uscriptstruct.h"
+#include "unrealsdk/unreal/classes/ustruct.h"
+#include "unrealsdk/unreal/prop_traits.h"
+#include "unrealsdk/unreal/properties/zclassproperty.h"
+#include "unrealsdk/unreal/properties/zcomponentproperty.h"
+#include "unrealsdk/unreal/properties/zobjectproperty.h"
+#include "unrealsdk/unreal/properties/zproperty.h"
+#include "unrealsdk/unreal/properties/zstructproperty.h"
+#include "unrealsdk/unreal/structs/fname.h"
+
+#ifdef PYUNREALSDK_INTERNAL
+
+using namespace unrealsdk::unreal;
+
+namespace pyunrealsdk::unreal {
+
+namespace {
+
+/**
+ * @brief Resolves a hop on the given type, if it differs from the type it was last resolved on.
+ * @note Throws if the field doesn't exist, or if an intermediate hop isn't an object/struct.
+ *
+ * @param hop The hop to resolve.
+ * @param type The type to resolve it on.
+ * @param is_final True if this is the final hop in the path, which may be any field.
+ */
+void resolve_hop(CompiledPath::Hop& hop, const UStruct* type, bool is_final) {
+    if (type == hop.type) {
+        return;
+    }
+
+    auto field = py_find_field(hop.name, type);
+
+    if (!is_final) {
+        if (field.kind != FieldKind::PROPERTY) {
+            throw py::attribute_error(
+                std::format("cannot walk through '{}', it's not a property", hop.name));
+        }
+        if (field.prop->ArrayDim() != 1) {
+            throw py::attribute_error(
+                std::format("cannot walk through '{}', it's a fixed array", hop.name));
+        }
+
+        bool valid = false;
+        cast(field.prop, [&hop, &valid]<typename T>([[maybe_unused]] const T* prop) {
+            // Only walk through the object properties which store a raw pointer
+            if constexpr (std::is_same_v<T, ZObjectProperty> || std::is_same_v<T, ZClassProperty>
+                          || std::is_same_v<T, ZComponentProperty>) {
+                hop.kind = CompiledPath::HopKind::OBJECT;
+                hop.next_type = prop->PropertyClass();
+                valid = true;
+            } else if constexpr (std::is_same_v<T, ZStructProperty>) {
+                hop.kind = CompiledPath::HopKind::STRUCT;
+                hop.next_type = prop->Struct();
+                valid = true;
+            }
+        });
+        if (!valid) {
+            throw py::attribute_error(std::format(
+                "cannot walk through '{}', it's not an object or struct property", hop.name));
+        }
+    }
+
+    hop.field = field;
+    hop.type = type;
+}
+
+}  // namespace
+
+CompiledPath::CompiledPath(UClass* cls, std::string_view path) : cls(cls), path(path) {
+    if (cls == nullptr) {
+        throw std::invalid_argument("Passed class was null!");
+    }
+    if (path.empty()) {
+        throw std::invalid_argument("Path cannot be empty");
+    }
+
+    for (const auto& segment : std::views::split(path, '.')) {
+        if (segment.empty()) {
+            throw std::invalid_argument(std::format("Invalid path '{}'", path));
+        }
+        this->hops.push_back({.name = FName{std::string{segment.begin(), segment.end()}}});
+    }
+    // Walking relies on there always being a final hop
+    if (this->hops.empty()) {
+        throw std::invalid_argument(std::format("Invalid path '{}'", path));
+    }
+
+    // Resolve everything on the static types, so that any errors are raised straight away
+    const UStruct* type = cls;
+    for (size_t i = 0; i < this->hops.size(); i++) {
+        if (type == nullptr) {
+            throw std::invalid_argument(std::format("Couldn't work out the type of '{}' in '{}'",
+                                                    this->hops[i - 1].name, path));
+        }
+
+        auto& hop = this->hops[i];
+        resolve_hop(hop, type, i == this->hops.size() - 1);
+        type = hop.next_type;
+    }
+}
+
+py::object CompiledPath::walk(UObject* obj) {
+    if (obj == nullptr) {
+        return py::none();
+    }
+
+    auto base_addr = reinterpret_cast<uintptr_t>(obj);
+    const UStruct* type = obj->Class();
+    // Functions can only be bound while we're directly on an object, not within a struct
+    UObject* func_obj = obj;
+
+    for (size_t i = 0; i < this->hops.size() - 1; i++) {
+        auto& hop = this->hops[i];
+        resolve_hop(hop, type, false);
+
+        if (hop.kind == HopKind::STRUCT) {
+            base_addr += hop.field.prop->Offset_Internal();
+            type = hop.next_type;
+            func_obj = nullptr;
+            continue;
+        }
+
+        auto next_obj = get_property<ZObjectProperty>(
+            reinterpret_cast<const ZObjectProperty*>(hop.field.prop), 0, base_addr);
+        if (next_obj == nullptr) {
+            return py::none();
+        }
+
+        base_addr = reinterpret_cast<uintptr_t>(next_obj);
+        type = next_obj->Class();
+        func_obj = next_obj;
+    }
+
+    auto& final_hop = this->hops.back();
+    resolve_hop(final_hop, type, true);
+    return py_getattr(final_hop.field, base_addr, nullptr, func_obj);
+}
+
+void register_compiled_path(py::module_& mod) {
+    PYUNREALSDK_STUBGEN_MODULE_N("unrealsdk.unreal")
+
+    py::classh<CompiledPath>(
+        mod, PYUNREALSDK_STUBGEN_CLASS("CompiledPath", ),
+        PYUNREALSDK_STUBGEN_DOCSTRING(
+            "A chain of attribute accesses, with each field already looked up.\n"
+            "\n"
+            "Calling this on an object is equivalent to getting each attribute in turn, except\n"
+            "intermediate values never get converted to python, and it returns None as soon as\n"
+            "it hits a null object.\n"
+            "\n"
+            "Create using unrealsdk.compile_path().\n"))
+        .def(
+            PYUNREALSDK_STUBGEN_METHOD("__repr__", "str"),
+            [](const CompiledPath& self) {
+                return std::format("<compiled path {}.{}>", self.cls->Name(), self.path);
+            },
+            PYUNREALSDK_STUBGEN_DOCSTRING("Gets a string representation of this path.\n"
+                                          "\n"
+                                          "Returns:\n"
+                                          "    The string representation.\n"))
+        .def(PYUNREALSDK_STUBGEN_METHOD("__call__", "Any"), &CompiledPath::walk,
+             PYUNREALSDK_STUBGEN_DOCSTRING(
+                 "Walks this path on an object.\n"
+                 "\n"
+                 "Fields are looked up again if an object along the path has a different class\n"
+                 "to the last call, so this may be used on subclasses of the compiled class.\n"
+                 "\n"
+                 "Args:\n"
+                 "    obj: The object to start from.\n"
+                 "Returns:\n"
+                 "    The value at the end of the path, or None if any object along the way was\n"
+                 "    null.\n"),
+             PYUNREALSDK_STUBGEN_ARG("obj"_a, "UObject | None", ))
+        .def_readonly(PYUNREALSDK_STUBGEN_READONLY_PROP("cls", "UClass"), &CompiledPath::cls)
+        .def_readonly(PYUNREALSDK_STUBGEN_READONLY_PROP("path", "str"), &CompiledPath::path);
+}
+
+}  // namespace pyunrealsdk::unreal
+
+#endif
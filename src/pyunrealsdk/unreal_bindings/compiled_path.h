@@ -0,0 +1,73 @@
+#ifndef PYUNREALSDK_UNREAL_BINDINGS_COMPILED_PATH_H
+#define PYUNREALSDK_UNREAL_BINDINGS_COMPILED_PATH_H
+
+#include "pyunrealsdk/pch.h"
+#include "pyunrealsdk/unreal_bindings/property_access.h"
+#include "unrealsdk/unreal/structs/fname.h"
+
+#ifdef PYUNREALSDK_INTERNAL
+
+namespace unrealsdk::unreal {
+
+class UClass;
+class UObject;
+class UStruct;
+
+}  // namespace unrealsdk::unreal
+
+namespace pyunrealsdk::unreal {
+
+// A chain of attribute accesses, with each hop's field looked up ahead of time.
+class CompiledPath {
+   public:
+    // What kind of value an intermediate hop walks through
+    enum class HopKind : uint8_t {
+        OBJECT,
+        STRUCT,
+    };
+
+    struct Hop {
+        unrealsdk::unreal::FName name;
+        // The type this hop was last resolved on
+        const unrealsdk::unreal::UStruct* type = nullptr;
+        ResolvedField field;
+        // Only set on intermediate hops
+        HopKind kind = HopKind::OBJECT;
+        // The static type of the value this hop walks into
+        const unrealsdk::unreal::UStruct* next_type = nullptr;
+    };
+
+    unrealsdk::unreal::UClass* cls;
+    std::string path;
+    std::vector<Hop> hops;
+
+    /**
+     * @brief Compiles a new path.
+     * @note Throws if the path is not valid on the given class.
+     *
+     * @param cls The class the path starts from.
+     * @param path The path, as a dot separated list of attribute names.
+     */
+    CompiledPath(unrealsdk::unreal::UClass* cls, std::string_view path);
+
+    /**
+     * @brief Walks this path on an object.
+     *
+     * @param obj The object to start from.
+     * @return The value at the end of the path, or None if any object along the way was null.
+     */
+    py::object walk(unrealsdk::unreal::UObject* obj);
+};
+
+/**
+ * @brief Registers CompiledPath.
+ *
+ * @param module The module to register within.
+ */
+void register_compiled_path(py::module_& mod);
+
+}  // namespace pyunrealsdk::unreal
+
+#endif
+
+#endif /* PYUNREALSDK_UNREAL_BINDINGS_COMPILED_PATH_H */
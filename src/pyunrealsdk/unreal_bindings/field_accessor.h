@@ -0,0 +1,41 @@
+#ifndef PYUNREALSDK_UNREAL_BINDINGS_FIELD_ACCESSOR_H
+#define PYUNREALSDK_UNREAL_BINDINGS_FIELD_ACCESSOR_H
+
+#include "pyunrealsdk/pch.h"
+#include "pyunrealsdk/unreal_bindings/property_access.h"
+
+#ifdef PYUNREALSDK_INTERNAL
+
+namespace unrealsdk::unreal {
+
+class ZProperty;
+
+}  // namespace unrealsdk::unreal
+
+namespace pyunrealsdk::unreal {
+
+// A property, with it's type specific getter/setter already looked up.
+struct FieldAccessor {
+    unrealsdk::unreal::ZProperty* prop;
+    PropertyAccessors accessors;
+
+    /**
+     * @brief Creates a new accessor for the given property.
+     *
+     * @param prop The property to access.
+     */
+    FieldAccessor(unrealsdk::unreal::ZProperty* prop);
+};
+
+/**
+ * @brief Registers FieldAccessor.
+ *
+ * @param module The module to register within.
+ */
+void register_field_accessor(py::module_& mod);
+
+}  // namespace pyunrealsdk::unreal
+
+#endif
+
+#endif /* PYUNREALSDK_UNREAL_BINDINGS_FIELD_ACCESSOR_H */
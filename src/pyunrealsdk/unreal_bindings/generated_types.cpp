@@ -0,0 +1,128 @@
+#include "pyunrealsdk/pch.h"
+#include "pyunrealsdk/unreal_bindings/generated_types.h"
+#include "pyunrealsdk/static_py_object.h"
+#include "pyunrealsdk/stubgen.h"
+#include "pyunrealsdk/unreal_bindings/field_accessor.h"
+#include "unrealsdk/unreal/classes/ustruct.h"
+#include "unrealsdk/unreal/classes/ustruct_funcs.h"
+#include "unrealsdk/unreal/properties/zproperty.h"
+#include "unrealsdk/unreal/structs/fname.h"
+
+#ifdef PYUNREALSDK_INTERNAL
+
+using namespace unrealsdk::unreal;
+
+namespace pyunrealsdk::unreal {
+
+namespace {
+
+bool use_generated_types = false;
+
+struct GeneratedType {
+    StaticPyObject type;
+    // A copy of the base type's info, pointing at the generated type instead. Pybind creates new
+    // instances using the type stored in here, but otherwise treats them as the base type.
+    py::detail::type_info info;
+    const py::detail::type_info* base;
+    // The struct's object index at the time we generated the type, to detect if it's been replaced
+    int32_t struct_index;
+};
+
+// Only ever accessed while holding the GIL, so doesn't need any further locking
+std::unordered_map<const UStruct*, std::unique_ptr<GeneratedType>> generated_types{};
+
+/**
+ * @brief Creates a new python type for the given unreal type.
+ *
+ * @param type The unreal class/struct to create a type for.
+ * @param base The python type to inherit from.
+ * @return The new type.
+ */
+py::object make_generated_type(const UStruct* type, const py::type& base) {
+    py::dict attrs{};
+    // Don't add a dict, so the layout stays compatible with the base
+    attrs["__slots__"] = py::tuple{};
+    attrs["__module__"] = base.attr("__module__");
+    // Keep the base type's setattr - properties which we skip below still need it as a fallback.
+    // The descriptors are data descriptors, so it still finds them first for everything else.
+
+    for (auto prop : type->properties()) {
+        auto name = py::cast(prop->Name());
+
+        // Don't shadow anything which already exists on the base type (e.g. `UObject.Name`), or
+        // which a more derived struct already added
+        if (attrs.contains(name) || py::hasattr(base, name)) {
+            continue;
+        }
+
+        try {
+            attrs[name] = FieldAccessor{prop};
+        } catch (const std::exception&) {
+            // If we don't know how to access this property type, leave it to the base type's
+            // getattr, which will raise a more useful error if someone tries to access it
+            continue;
+        }
+    }
+
+    // Call the base's metaclass, so we get a proper pybind type
+    return py::type::of(base)(py::cast(type->Name()), py::make_tuple(base), attrs);
+}
+
+}  // namespace
+
+void register_generated_types(py::module_& mod) {
+    PYUNREALSDK_STUBGEN_MODULE_N("unrealsdk.unreal")
+
+    mod.def(
+        PYUNREALSDK_STUBGEN_FUNC("use_generated_types", "None"),
+        [](bool should_use) { use_generated_types = should_use; },
+        PYUNREALSDK_STUBGEN_DOCSTRING(
+            "Sets if unreal objects and structs should use generated per-type subclasses.\n"
+            "\n"
+            "When enabled, objects/structs retrieved from unreal are given a subclass of their\n"
+            "usual type, generated from their unreal class/struct, which contains a\n"
+            "FieldAccessor for each property. This makes accessing properties faster, since\n"
+            "they're found through the standard python attribute lookup.\n"
+            "\n"
+            "This means types are not exact, `type(obj) is UObject` becomes false, though\n"
+            "isinstance checks still work as normal. Objects retrieved before enabling keep\n"
+            "their previous type. Defaults to false.\n"
+            "\n"
+            "Args:\n"
+            "    should_use: True if to use generated types, false to not.\n"),
+        PYUNREALSDK_STUBGEN_ARG("should_use"_a, "bool", ));
+}
+
+bool generated_types_enabled(void) {
+    return use_generated_types;
+}
+
+const py::detail::type_info* get_generated_type_info(const UStruct* type,
+                                                     const py::detail::type_info* base) {
+    auto struct_index = type->InternalIndex();
+
+    auto iter = generated_types.find(type);
+    if (iter != generated_types.end() && iter->second->base == base
+        && iter->second->struct_index == struct_index) {
+        return &iter->second->info;
+    }
+
+    auto base_type = py::reinterpret_borrow<py::type>(reinterpret_cast<PyObject*>(base->type));
+    auto new_type = make_generated_type(type, base_type);
+
+    auto generated = std::make_unique<GeneratedType>(GeneratedType{
+        .type = new_type,
+        .info = *base,
+        .base = base,
+        .struct_index = struct_index,
+    });
+    generated->info.type = reinterpret_cast<PyTypeObject*>(new_type.ptr());
+
+    auto info = &generated->info;
+    generated_types.insert_or_assign(type, std::move(generated));
+    return info;
+}
+
+}  // namespace pyunrealsdk::unreal
+
+#endif
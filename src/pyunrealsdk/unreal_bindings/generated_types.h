@@ -0,0 +1,45 @@
+#ifndef PYUNREALSDK_UNREAL_BINDINGS_GENERATED_TYPES_H
+#define PYUNREALSDK_UNREAL_BINDINGS_GENERATED_TYPES_H
+
+#include "pyunrealsdk/pch.h"
+
+#ifdef PYUNREALSDK_INTERNAL
+
+namespace unrealsdk::unreal {
+
+class UStruct;
+
+}  // namespace unrealsdk::unreal
+
+namespace pyunrealsdk::unreal {
+
+/**
+ * @brief Registers the generated type helpers.
+ *
+ * @param mod The module to register within.
+ */
+void register_generated_types(py::module_& mod);
+
+/**
+ * @brief Checks if objects and structs should be cast to their generated types.
+ *
+ * @return True if generated types are enabled.
+ */
+[[nodiscard]] bool generated_types_enabled(void);
+
+/**
+ * @brief Gets the pybind type info to use when casting objects/structs of the given unreal type.
+ * @note Generates the python type on first use.
+ *
+ * @param type The unreal class or struct type of the object being cast.
+ * @param base The type info pybind would normally use, which the generated type inherits from.
+ * @return The type info of the generated type.
+ */
+const py::detail::type_info* get_generated_type_info(const unrealsdk::unreal::UStruct* type,
+                                                     const py::detail::type_info* base);
+
+}  // namespace pyunrealsdk::unreal
+
+#endif
+
+#endif /* PYUNREALSDK_UNREAL_BINDINGS_GENERATED_TYPES_H */
@@ -0,0 +1,191 @@
+#include "pyunrealsdk/pch.h"
+#include "pyunrealsdk/unreal_bindings/prepared_call.h"
+#include "pyunrealsdk/stubgen.h"
+#include "pyunrealsdk/unreal_bindings/bound_function.h"
+#include "unrealsdk/unreal/classes/ufunction.h"
+#include "unrealsdk/unreal/classes/uobject.h"
+#include "unrealsdk/unreal/cast.h"
+#include "unrealsdk/unreal/prop_traits.h"
+#include "unrealsdk/unreal/properties/zproperty.h"
+#include "unrealsdk/unreal/wrappers/bound_function.h"
+#include "unrealsdk/unreal/wrappers/wrapped_array.h"
+#include "unrealsdk/unreal/wrappers/wrapped_multicast_delegate.h"
+#include "unrealsdk/unreal/wrappers/wrapped_struct.h"
+#include "unrealsdk/utils.h"
+
+#ifdef PYUNREALSDK_INTERNAL
+
+using namespace unrealsdk::unreal;
+
+namespace pyunrealsdk::unreal {
+
+namespace {
+
+/**
+ * @brief Checks if a property's python value is a reference into the memory it was read from.
+ *
+ * @param prop The property to check.
+ * @return True if the python value references the original memory.
+ */
+bool py_value_references_memory(ZProperty* prop) {
+    bool references = false;
+    cast(prop, [&references]<typename T>(const T* /*prop*/) {
+        using Value = typename PropTraits<T>::Value;
+        references = std::is_same_v<Value, WrappedStruct> || std::is_same_v<Value, WrappedArray>
+                     || std::is_same_v<Value, WrappedMulticastDelegate>;
+    });
+    return references;
+}
+
+/**
+ * @brief Copies the value of a param from one params struct to another.
+ *
+ * @param prop The param to copy.
+ * @param src The params struct to copy from.
+ * @param dest The params struct to copy to.
+ */
+void copy_param(ZProperty* prop, const WrappedStruct& src, const WrappedStruct& dest) {
+    auto src_addr = reinterpret_cast<uintptr_t>(src.base.get());
+    auto dest_addr = reinterpret_cast<uintptr_t>(dest.base.get());
+    cast(prop, [src_addr, dest_addr]<typename T>(const T* prop) {
+        for (size_t i = 0; i < static_cast<size_t>(prop->ArrayDim()); i++) {
+            set_property<T>(prop, i, dest_addr, get_property<T>(prop, i, src_addr));
+        }
+    });
+}
+
+}  // namespace
+
+PreparedCall::PreparedCall(const BoundFunction& bound, const py::kwargs& fixed_args)
+    : bound(bound), info(bound.func), fixed(), varying(), fixed_outs(), working() {
+    impl::ParamBinder binder{this->info.params, *this->info.plan};
+    for (const auto& [key, value] : fixed_args) {
+        binder.keyword(key.ptr(), value.ptr());
+    }
+    this->fixed = binder.given_params();
+
+    const auto& plan = *this->info.plan;
+    for (size_t i = 0; i < plan.params.size(); i++) {
+        if (!this->fixed.test(i)) {
+            this->varying.push_back(i);
+        } else if ((plan.params[i].prop->PropertyFlags() & ZProperty::PROP_FLAG_OUT) != 0) {
+            this->fixed_outs.push_back(i);
+        }
+    }
+
+    // If we return references into the struct, every call needs a fresh copy, so that the next
+    // call doesn't overwrite results the caller may still be holding on to
+    auto results_reference_params =
+        (plan.return_param.prop != nullptr && py_value_references_memory(plan.return_param.prop))
+        || std::ranges::any_of(plan.out_params, [](const auto& slot) {
+               return py_value_references_memory(slot.prop);
+           });
+    if (!results_reference_params) {
+        this->working.emplace(this->info);
+    }
+}
+
+py::object PreparedCall::call(const py::args& args, const py::kwargs& kwargs) {
+    if (this->varying.size() < args.size()) {
+        throw py::type_error(std::format("{}() takes {} positional args, but {} were given",
+                                         this->bound.func->Name(), this->varying.size(),
+                                         args.size()));
+    }
+
+    // If the working params struct is already in use, e.g. if we got called again from inside a
+    // hook on the function, work on a fresh copy instead, so we don't overwrite the outer call
+    std::optional<impl::PyCallInfo> copy{};
+    if (this->in_call || !this->working.has_value()) {
+        copy.emplace(this->info);
+    }
+    auto& call_info = copy.has_value() ? *copy : *this->working;
+
+    impl::ParamBinder binder{call_info.params, *call_info.plan, this->fixed};
+    for (size_t i = 0; i < args.size(); i++) {
+        binder.slot(this->varying[i], PyTuple_GET_ITEM(args.ptr(), i));
+    }
+    for (const auto& [key, value] : kwargs) {
+        binder.keyword(key.ptr(), value.ptr());
+    }
+    binder.finish();
+
+    if (copy.has_value()) {
+        return impl::call_bound_function(this->bound, call_info);
+    }
+
+    // The last call may have written to the working struct, reset anything we didn't just write
+    // back to how it was when prepared - fixed out params to their fixed value, and any optional
+    // args which weren't given back to their defaults
+    const auto& plan = *this->info.plan;
+    for (auto idx : this->fixed_outs) {
+        copy_param(plan.params[idx].prop, this->info.params, call_info.params);
+    }
+    const auto& given = binder.given_params();
+    for (auto idx : this->varying) {
+        if (!given.test(idx)) {
+            copy_param(plan.params[idx].prop, this->info.params, call_info.params);
+        }
+    }
+
+    this->in_call = true;
+    try {
+        auto ret = impl::call_bound_function(this->bound, call_info);
+        this->in_call = false;
+        return ret;
+    } catch (...) {
+        this->in_call = false;
+        throw;
+    }
+}
+
+void register_prepared_call(py::module_& mod) {
+    PYUNREALSDK_STUBGEN_MODULE_N("unrealsdk.unreal")
+
+    py::classh<PreparedCall>(
+        mod, PYUNREALSDK_STUBGEN_CLASS("PreparedCall", ),
+        PYUNREALSDK_STUBGEN_DOCSTRING(
+            "A bound function with some of it's args already filled in.\n"
+            "\n"
+            "The same params struct is reused on every call, the fixed args are only converted\n"
+            "once, and only the remaining args get written each call. Each call otherwise\n"
+            "behaves exactly like calling the bound function directly - fixed out params are\n"
+            "reset to their fixed value, and optional args which aren't given use their\n"
+            "defaults, rather than anything left over from the previous call.\n"
+            "\n"
+            "If the function returns a struct, array, or multicast delegate, either directly\n"
+            "or as an out param, each call instead works on a fresh copy of the params struct,\n"
+            "since these are returned as references into it.\n"
+            "\n"
+            "Create using BoundFunction.prepare().\n"))
+        .def(
+            PYUNREALSDK_STUBGEN_METHOD("__repr__", "str"),
+            [](const PreparedCall& self) {
+                return std::format("<prepared call {} on {}>", self.bound.func->Name(),
+                                   unrealsdk::utils::narrow(self.bound.object->get_path_name()));
+            },
+            PYUNREALSDK_STUBGEN_DOCSTRING("Gets a string representation of this call.\n"
+                                          "\n"
+                                          "Returns:\n"
+                                          "    The string representation.\n"))
+        .def(PYUNREALSDK_STUBGEN_METHOD("__call__", "Any:  # noqa: D417 "), &PreparedCall::call,
+             PYUNREALSDK_STUBGEN_DOCSTRING(
+                 "Calls the function.\n"
+                 "\n"
+                 "Args:\n"
+                 "    The unreal function's args which weren't fixed, in positional order.\n"
+                 "    Kwargs are supported, but may not include any of the fixed args.\n"
+                 "Returns:\n"
+                 "    The same as calling the bound function directly.\n")
+                 PYUNREALSDK_STUBGEN_ARG_N("*args"_a, "Any", )
+                     PYUNREALSDK_STUBGEN_ARG_N("**kwargs"_a, "Any", ))
+        .def_property_readonly(
+            PYUNREALSDK_STUBGEN_READONLY_PROP("func", "UFunction"),
+            [](const PreparedCall& self) { return self.bound.func; })
+        .def_property_readonly(
+            PYUNREALSDK_STUBGEN_READONLY_PROP("object", "UObject"),
+            [](const PreparedCall& self) { return self.bound.object; });
+}
+
+}  // namespace pyunrealsdk::unreal
+
+#endif
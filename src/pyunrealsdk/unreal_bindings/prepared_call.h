@@ -0,0 +1,61 @@
+#ifndef PYUNREALSDK_UNREAL_BINDINGS_PREPARED_CALL_H
+#define PYUNREALSDK_UNREAL_BINDINGS_PREPARED_CALL_H
+
+#include "pyunrealsdk/pch.h"
+#include "pyunrealsdk/unreal_bindings/bound_function.h"
+#include "unrealsdk/unreal/wrappers/bound_function.h"
+
+#ifdef PYUNREALSDK_INTERNAL
+
+namespace pyunrealsdk::unreal {
+
+// A bound function with some of it's args already filled in, which reuses the same params struct
+// on every call.
+class PreparedCall {
+   public:
+    unrealsdk::unreal::BoundFunction bound;
+    // Only holds the fixed args, this is never called with directly. Calls either run on the
+    // working copy below, or on a fresh copy of this.
+    impl::PyCallInfo info;
+    // Which params were fixed when preparing
+    impl::CallPlan::ParamMask fixed;
+    // The indexes of the params which weren't fixed, in positional order
+    std::vector<size_t> varying;
+    // The indexes of the fixed params which the function may write to, so need to be reset before
+    // reusing the working copy
+    std::vector<size_t> fixed_outs;
+    // The params struct reused between calls. Empty if each call must use a fresh copy.
+    std::optional<impl::PyCallInfo> working;
+    // True while the working params struct is being used by a call
+    bool in_call = false;
+
+    /**
+     * @brief Prepares a new call.
+     *
+     * @param bound The function to call.
+     * @param fixed_args The args to fix, which will be used on every call.
+     */
+    PreparedCall(const unrealsdk::unreal::BoundFunction& bound, const py::kwargs& fixed_args);
+
+    /**
+     * @brief Calls the function, filling in the remaining args.
+     *
+     * @param args The python args.
+     * @param kwargs The python kwargs.
+     * @return The value to return to python.
+     */
+    py::object call(const py::args& args, const py::kwargs& kwargs);
+};
+
+/**
+ * @brief Registers PreparedCall.
+ *
+ * @param module The module to register within.
+ */
+void register_prepared_call(py::module_& mod);
+
+}  // namespace pyunrealsdk::unreal
+
+#endif
+
+#endif /* PYUNREALSDK_UNREAL_BINDINGS_PREPARED_CALL_H */
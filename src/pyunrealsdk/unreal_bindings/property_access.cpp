@@ -79,13 +79,122 @@ UField* PyFieldVariant::as_non_prop_field(void) const {
     return obj;
 }
 
-PyFieldVariant py_find_field(const FName& name, const UStruct* type) {
+ResolvedField resolve_field(const PyFieldVariant& field) {
+    ZProperty* prop = field.as_prop();
+    if (prop != nullptr) {
+        return {.kind = FieldKind::PROPERTY, .prop = prop};
+    }
+
+    UField* ufield = field.as_non_prop_field();
+    if (ufield == nullptr) {
+        return {};
+    }
+
+    auto kind = FieldKind::UNKNOWN;
+    if (ufield->is_instance(find_class<UFunction>())) {
+        kind = FieldKind::FUNCTION;
+    } else if (ufield->is_instance(find_class<UScriptStruct>())) {
+        kind = FieldKind::SCRIPT_STRUCT;
+    } else if (ufield->is_instance(find_class<UConst>())) {
+        kind = FieldKind::CONST;
+    } else if (ufield->is_instance(find_class<UEnum>())) {
+        kind = FieldKind::ENUM;
+    }
+    return {.kind = kind, .field = ufield};
+}
+
+namespace {
+
+struct FieldCacheKey {
+    const UStruct* type;
+    FName name;
+
+    bool operator==(const FieldCacheKey& other) const = default;
+};
+
+struct FieldCacheKeyHash {
+    size_t operator()(const FieldCacheKey& key) const noexcept {
+        auto hash = std::hash<const UStruct*>{}(key.type);
+        // Same mixing as boost::hash_combine
+        return hash ^ (std::hash<FName>{}(key.name) + 0x9e3779b9 + (hash << 6) + (hash >> 2));
+    }
+};
+
+struct FieldCacheEntry {
+    ResolvedField field;
+    // The struct's object index at the time we looked it up. If a struct gets unloaded, a new one
+    // may be allocated at the same address, this lets us detect it and redo the lookup.
+    int32_t type_index;
+};
+
+// Past this many entries, the field cache stops growing, and we fall back to uncached lookups.
+const constexpr size_t field_cache_max_size = 0x10000;
+
+// Misses are kept separately, since they may come from arbitrary names (e.g. `hasattr` probes).
+// Once full, the miss cache gets cleared and starts again, so commonly probed names quickly end up
+// back in it, while one-off names can't grow it forever.
+const constexpr size_t field_miss_cache_max_size = 0x1000;
+
+// Only ever accessed while holding the GIL, so doesn't need any further locking
+std::unordered_map<FieldCacheKey, FieldCacheEntry, FieldCacheKeyHash> field_cache{};
+// Maps missing fields to the struct's object index at the time we looked them up
+std::unordered_map<FieldCacheKey, int32_t, FieldCacheKeyHash> field_miss_cache{};
+
+}  // namespace
+
+ResolvedField try_find_field(const FName& name, const UStruct* type) {
+    const FieldCacheKey key{.type = type, .name = name};
+    auto type_index = type->InternalIndex();
+
+    auto iter = field_cache.find(key);
+    if (iter != field_cache.end() && iter->second.type_index == type_index) {
+        return iter->second.field;
+    }
+    auto miss_iter = field_miss_cache.find(key);
+    if (miss_iter != field_miss_cache.end() && miss_iter->second == type_index) {
+        return {};
+    }
+
+    ResolvedField resolved{};
     try {
-        return {type->find(name)};
+        resolved = resolve_field(PyFieldVariant{type->find(name)});
     } catch (const std::invalid_argument&) {
+        // Drop any stale hit left over from an unloaded struct
+        if (iter != field_cache.end()) {
+            field_cache.erase(iter);
+        }
+
+        if (miss_iter != field_miss_cache.end()) {
+            miss_iter->second = type_index;
+        } else {
+            if (field_miss_cache.size() >= field_miss_cache_max_size) {
+                field_miss_cache.clear();
+            }
+            field_miss_cache.emplace(key, type_index);
+        }
+        return resolved;
+    }
+
+    // Similarly, drop any stale miss
+    if (miss_iter != field_miss_cache.end()) {
+        field_miss_cache.erase(miss_iter);
+    }
+
+    if (iter != field_cache.end()) {
+        iter->second = FieldCacheEntry{.field = resolved, .type_index = type_index};
+    } else if (field_cache.size() < field_cache_max_size) {
+        field_cache.emplace(key, FieldCacheEntry{.field = resolved, .type_index = type_index});
+    }
+    return resolved;
+}
+
+ResolvedField py_find_field(const FName& name, const UStruct* type) {
+    auto field = try_find_field(name, type);
+    if (field.kind == FieldKind::MISSING) {
         throw py::attribute_error(
             std::format("'{}' object has no attribute '{}'", type->Name(), name));
     }
+    return field;
 }
 
 void register_property_helpers(py::module_& mod) {
@@ -134,164 +243,241 @@ std::vector<std::string> py_dir(const py::object& self, const UStruct* type) {
 
 namespace {
 
-py::object py_getattr_property(ZProperty* prop,
-                               uintptr_t base_addr,
-                               const unrealsdk::unreal::UnrealPointer<void>& parent) {
-    if (prop->ArrayDim() < 1) {
+/**
+ * @brief Gets a single element of a property, converting enums as required.
+ *
+ * @tparam T The property type.
+ * @param prop The property to get.
+ * @param idx The fixed array index to get.
+ * @param base_addr The base address of the object.
+ * @param parent Pointer to a parent allocation to copy ownership from.
+ * @return The retrieved value.
+ */
+template <typename T>
+py::object py_getattr_single(const T* prop,
+                             size_t idx,
+                             uintptr_t base_addr,
+                             const unrealsdk::unreal::UnrealPointer<void>& parent) {
+    auto val = get_property<T>(prop, idx, base_addr, parent);
+
+    // Multiple property types expose a get enum method
+    constexpr bool is_enum = requires(T* type) {
+        { type->Enum() } -> std::convertible_to<UEnum*>;
+    };
+
+    // If the value we're reading is an enum, convert it to a python enum
+    if constexpr (is_enum) {
+        auto ue_enum = prop->Enum();
+        if (ue_enum != nullptr) {
+            return enum_value_as_py(ue_enum, static_cast<int64_t>(val));
+        }
+    }
+
+    // Otherwise return as is
+    return py::cast(std::move(val));
+}
+
+template <typename T>
+py::object py_getattr_typed(const T* prop,
+                            uintptr_t base_addr,
+                            const unrealsdk::unreal::UnrealPointer<void>& parent) {
+    auto array_dim = prop->ArrayDim();
+
+    // Almost every property is a scalar, so return it directly, without creating any containers
+    if (array_dim == 1) {
+        return py_getattr_single<T>(prop, 0, base_addr, parent);
+    }
+
+    if (array_dim < 1) {
         throw py::attribute_error(
-            std::format("attribute '{}' has size of {}", prop->Name(), prop->ArrayDim()));
+            std::format("attribute '{}' has size of {}", prop->Name(), array_dim));
     }
 
-    // If we have a static array, return it as a tuple.
-    // Store in a list for now so we can still append.
-    py::list ret{prop->ArrayDim()};
+    // If we have a static array, return it as a tuple
+    py::tuple ret{array_dim};
+    for (size_t i = 0; i < static_cast<size_t>(array_dim); i++) {
+        ret[i] = py_getattr_single<T>(prop, i, base_addr, parent);
+    }
+    return ret;
+}
 
+py::object py_getattr_property(ZProperty* prop,
+                               uintptr_t base_addr,
+                               const unrealsdk::unreal::UnrealPointer<void>& parent) {
+    py::object ret;
     cast(prop, [base_addr, &ret, &parent]<typename T>(const T* prop) {
-        for (size_t i = 0; i < static_cast<size_t>(prop->ArrayDim()); i++) {
-            auto val = get_property<T>(prop, i, base_addr, parent);
-
-            // Multiple property types expose a get enum method
-            constexpr bool is_enum = requires(T* type) {
-                { type->Enum() } -> std::convertible_to<UEnum*>;
-            };
-
-            // If the value we're reading is an enum, convert it to a python enum
-            if constexpr (is_enum) {
-                auto ue_enum = prop->Enum();
-                if (ue_enum != nullptr) {
-                    ret[i] = enum_as_py_enum(ue_enum)(val);
-                    continue;
-                }
-            }
-
-            // Otherwise store as is
-            ret[i] = std::move(val);
-        }
+        ret = py_getattr_typed<T>(prop, base_addr, parent);
     });
-    if (prop->ArrayDim() == 1) {
-        return ret[0];
-    }
-    return py::tuple(ret);
+    return ret;
 }
 
-py::object py_getattr_non_property(UField* field, UObject* func_obj) {
-    if (field->is_instance(find_class<UFunction>())) {
-        if (func_obj == nullptr) {
-            throw py::attribute_error(
-                std::format("cannot bind function '{}' with null object", field->Name()));
-        }
+py::object py_getattr_non_property(const ResolvedField& field, UObject* func_obj) {
+    switch (field.kind) {
+        case FieldKind::FUNCTION:
+            if (func_obj == nullptr) {
+                throw py::attribute_error(std::format("cannot bind function '{}' with null object",
+                                                      field.field->Name()));
+            }
+            return py::cast(BoundFunction{.func = reinterpret_cast<UFunction*>(field.field),
+                                          .object = func_obj});
 
-        return py::cast(
-            BoundFunction{.func = reinterpret_cast<UFunction*>(field), .object = func_obj});
-    }
+        case FieldKind::SCRIPT_STRUCT:
+            return py::cast(field.field);
 
-    if (field->is_instance(find_class<UScriptStruct>())) {
-        return py::cast(field);
-    }
+        case FieldKind::CONST:
+            return py::cast(std::string{reinterpret_cast<UConst*>(field.field)->Value()});
+
+        case FieldKind::ENUM:
+            return enum_as_py_enum(reinterpret_cast<UEnum*>(field.field));
 
-    if (field->is_instance(find_class<UConst>())) {
-        return py::cast(std::string{reinterpret_cast<UConst*>(field)->Value()});
+        default:
+            throw py::attribute_error(std::format("attribute '{}' has unknown type '{}'",
+                                                  field.field->Name(),
+                                                  field.field->Class()->Name()));
     }
+}
 
-    if (field->is_instance(find_class<UEnum>())) {
-        return enum_as_py_enum(reinterpret_cast<UEnum*>(field));
+/**
+ * @brief Sets a single element of a property.
+ *
+ * @tparam T The property type.
+ * @param prop The property to set.
+ * @param idx The fixed array index to set.
+ * @param base_addr The base address of the object.
+ * @param value The value to set.
+ */
+template <typename T>
+void py_setattr_single(const T* prop, size_t idx, uintptr_t base_addr, const py::object& value) {
+    // If we're setting a struct property, we might be being told to ignore it
+    if constexpr (std::is_base_of_v<ZStructProperty, T>) {
+        if (is_ignore_struct_sentinel(value)) {
+            return;
+        }
     }
 
-    throw py::attribute_error(
-        std::format("attribute '{}' has unknown type '{}'", field->Name(), field->Class()->Name()));
+    set_property<T>(prop, idx, base_addr, py::cast<typename PropTraits<T>::Value>(value));
 }
 
-// The templated lambda and all the if constexprs make everything have a really high penalty
-// Yes it's probably a bit complex, but it's also a bit awkward trying to split it up
-// NOLINTNEXTLINE(readability-function-cognitive-complexity)
-void py_setattr_direct(ZProperty* prop, uintptr_t base_addr, const py::object& value) {
-    py::sequence value_seq;
-    if (prop->ArrayDim() > 1) {
-        if (!py::isinstance<py::sequence>(value)) {
-            std::string value_type_name = py::str(py::type::of(value).attr("__name__"));
-            throw py::type_error(std::format(
-                "attribute value has unexpected type '{}', expected a sequence", value_type_name));
+/**
+ * @brief Tries to set an array property by assigning to a slice of the existing array.
+ *
+ * @param prop The array property to set.
+ * @param base_addr The base address of the object.
+ * @param value The value to set.
+ * @return True if the value was set, false if it should be set normally.
+ */
+bool try_set_array_via_slice(const ZArrayProperty* prop,
+                             uintptr_t base_addr,
+                             const py::object& value) {
+    // If the value is a wrapped array
+    if (py::isinstance<WrappedArray>(value)) {
+        // But the internal type does not match
+        if (py::cast<const WrappedArray&>(value).type != prop->Inner()) {
+            // We might be running into unrealsdk issue #60. If this is an array of ints for
+            // example, we still want to try let the assignment through, even if the properties
+            // are different
+
+            // Do this by falling back to slice assignment - it guards against bad types e.g. if
+            // you tried assigning an array of objects to an array of ints
+            auto arr = get_property<ZArrayProperty>(prop, 0, base_addr);
+            impl::array_py_setitem_slice(arr, py::slice(std::nullopt, std::nullopt, std::nullopt),
+                                         value);
+            return true;
         }
-        value_seq = value;
 
-        if (value_seq.size() > static_cast<size_t>(prop->ArrayDim())) {
-            throw py::type_error(
-                std::format("attribute value is too long, {} supports a maximum of {} values",
-                            prop->Name(), prop->ArrayDim()));
-        }
-    } else {
-        value_seq = py::make_tuple(value);
+        // If the value is a sequence (but not a wrapped array), we also want it to work
+    } else if (py::isinstance<py::sequence>(value)) {
+        // Once again, implement using slice assignment
+        auto arr = get_property<ZArrayProperty>(prop, 0, base_addr);
+        impl::array_py_setitem_slice(arr, py::slice(std::nullopt, std::nullopt, std::nullopt),
+                                     value);
+        return true;
     }
 
-    cast(prop, [base_addr, &value_seq]<typename T>(const T* prop) {
-        using value_type = PropTraits<T>::Value;
+    return false;
+}
 
-        const size_t seq_size = value_seq.size();
-        const size_t prop_size = prop->ArrayDim();
+template <typename T>
+void py_setattr_typed(const T* prop, uintptr_t base_addr, const py::object& value) {
+    const size_t prop_size = prop->ArrayDim();
 
-        // Some special casing for array properties
+    // Almost every property is a scalar, set it directly, without wrapping it in a sequence
+    if (prop_size == 1) {
+        // Array properties have some special casing - note this relies on the sdk not supporting
+        // fixed arrays of them, we let those fall through to the standard error handler
         if constexpr (std::is_same_v<T, ZArrayProperty>) {
-            // First make sure it's not somehow a fixed array, since the sdk can't handle that, let
-            // it fall through to the standard error handler
-            if (prop_size == 1 && seq_size == 1) {
-                // If the value is a wrapped array
-                if (py::isinstance<WrappedArray>(value_seq[0])) {
-                    // But the internal type does not match
-                    if (py::cast<WrappedArray>(value_seq[0]).type != prop->Inner()) {
-                        // We might be running into unrealsdk issue #60. If this is an array of ints
-                        // for example, we still want to try let the assignment through, even if the
-                        // properties are different
-
-                        // Do this by falling back to slice assignment - it guards against bad types
-                        // e.g. if you tried assigning an array of objects to an array of ints
-                        auto arr = get_property<ZArrayProperty>(prop, 0, base_addr);
-                        impl::array_py_setitem_slice(
-                            arr, py::slice(std::nullopt, std::nullopt, std::nullopt), value_seq[0]);
-                        return;
-                    }
-
-                    // If the value is a sequence (but not a wrapped array), we also want it to work
-                } else if (py::isinstance<py::sequence>(value_seq[0])) {
-                    // Once again, implement using slice assignment
-                    auto arr = get_property<ZArrayProperty>(prop, 0, base_addr);
-                    impl::array_py_setitem_slice(
-                        arr, py::slice(std::nullopt, std::nullopt, std::nullopt), value_seq[0]);
-                    return;
-                }
+            if (try_set_array_via_slice(prop, base_addr, value)) {
+                return;
             }
         }
 
-        // If we're default constructable, set all the missing fields to the default value
-        // If we're not, require specifying all values
-        // Do this before writing the given values so that we can error out without making changes
-        if constexpr (std::is_default_constructible_v<value_type>) {
-            for (size_t i = seq_size; i < prop_size; i++) {
-                set_property<T>(prop, i, base_addr, {});
-            }
-        } else {
-            if (seq_size != prop_size) {
-                throw py::type_error(std::format(
-                    "attribute value is too short, {} must be given as exactly {} values (no known "
-                    "default to use when less are given)",
-                    prop->Name(), prop->ArrayDim()));
-            }
-        }
+        py_setattr_single<T>(prop, 0, base_addr, value);
+        return;
+    }
 
-        for (size_t i = 0; i < seq_size; i++) {
-            // If we're setting a struct property, we might be being told to ignore it
-            if constexpr (std::is_base_of_v<ZStructProperty, T>) {
-                if (is_ignore_struct_sentinel(value_seq[i])) {
-                    continue;
-                }
-            }
+    if (!py::isinstance<py::sequence>(value)) {
+        std::string value_type_name = py::str(py::type::of(value).attr("__name__"));
+        throw py::type_error(std::format(
+            "attribute value has unexpected type '{}', expected a sequence", value_type_name));
+    }
+    auto value_seq = py::reinterpret_borrow<py::sequence>(value);
+
+    const size_t seq_size = value_seq.size();
+    if (seq_size > prop_size) {
+        throw py::type_error(
+            std::format("attribute value is too long, {} supports a maximum of {} values",
+                        prop->Name(), prop->ArrayDim()));
+    }
 
-            set_property<T>(prop, i, base_addr, py::cast<value_type>(value_seq[i]));
+    // If we're default constructable, set all the missing fields to the default value
+    // If we're not, require specifying all values
+    // Do this before writing the given values so that we can error out without making changes
+    if constexpr (std::is_default_constructible_v<typename PropTraits<T>::Value>) {
+        for (size_t i = seq_size; i < prop_size; i++) {
+            set_property<T>(prop, i, base_addr, {});
         }
+    } else {
+        if (seq_size != prop_size) {
+            throw py::type_error(std::format(
+                "attribute value is too short, {} must be given as exactly {} values (no known "
+                "default to use when less are given)",
+                prop->Name(), prop->ArrayDim()));
+        }
+    }
+
+    for (size_t i = 0; i < seq_size; i++) {
+        py_setattr_single<T>(prop, i, base_addr, value_seq[i]);
+    }
+}
+
+void py_setattr_direct(ZProperty* prop, uintptr_t base_addr, const py::object& value) {
+    cast(prop, [base_addr, &value]<typename T>(const T* prop) {
+        py_setattr_typed<T>(prop, base_addr, value);
     });
 }
 
+template <typename T>
+py::object erased_getattr(const ZProperty* prop,
+                          uintptr_t base_addr,
+                          const unrealsdk::unreal::UnrealPointer<void>& parent) {
+    return py_getattr_typed<T>(static_cast<const T*>(prop), base_addr, parent);
+}
+
+template <typename T>
+void erased_setattr(const ZProperty* prop, uintptr_t base_addr, const py::object& value) {
+    py_setattr_typed<T>(static_cast<const T*>(prop), base_addr, value);
+}
+
 }  // namespace
 
+PropertyAccessors get_property_accessors(ZProperty* prop) {
+    PropertyAccessors ret{};
+    cast(prop, [&ret]<typename T>(const T* /*prop*/) {
+        ret = {.get = &erased_getattr<T>, .set = &erased_setattr<T>};
+    });
+    return ret;
+}
+
 // it's pointer sized so no point using a reference like clang tidy wants
 static_assert(sizeof(PyFieldVariant) <= sizeof(uintptr_t));
 
@@ -300,34 +486,39 @@ py::object py_getattr(PyFieldVariant field,
                       uintptr_t base_addr,
                       const unrealsdk::unreal::UnrealPointer<void>& parent,
                       unrealsdk::unreal::UObject* func_obj) {
-    ZProperty* prop = field.as_prop();
-    if (prop != nullptr) {
-        return py_getattr_property(prop, base_addr, parent);
-    }
+    return py_getattr(resolve_field(field), base_addr, parent, func_obj);
+}
 
-    UField* ufield = field.as_non_prop_field();
-    if (ufield != nullptr) {
-        return py_getattr_non_property(ufield, func_obj);
+py::object py_getattr(const ResolvedField& field,
+                      uintptr_t base_addr,
+                      const unrealsdk::unreal::UnrealPointer<void>& parent,
+                      unrealsdk::unreal::UObject* func_obj) {
+    switch (field.kind) {
+        case FieldKind::MISSING:
+            throw py::attribute_error("cannot get a null field");
+        case FieldKind::PROPERTY:
+            return py_getattr_property(field.prop, base_addr, parent);
+        default:
+            return py_getattr_non_property(field, func_obj);
     }
-
-    throw py::attribute_error("cannot get a null field");
 }
 
 // NOLINTNEXTLINE(performance-unnecessary-value-param)
 void py_setattr_direct(PyFieldVariant field, uintptr_t base_addr, const py::object& value) {
-    ZProperty* prop = field.as_prop();
-    if (prop != nullptr) {
-        py_setattr_direct(prop, base_addr, value);
-        return;
-    }
+    py_setattr_direct(resolve_field(field), base_addr, value);
+}
 
-    UField* ufield = field.as_non_prop_field();
-    if (ufield != nullptr) {
-        throw py::attribute_error(std::format(
-            "attribute '{}' is not a property, and thus cannot be set", ufield->Name()));
+void py_setattr_direct(const ResolvedField& field, uintptr_t base_addr, const py::object& value) {
+    switch (field.kind) {
+        case FieldKind::MISSING:
+            throw py::attribute_error("cannot set a null field");
+        case FieldKind::PROPERTY:
+            py_setattr_direct(field.prop, base_addr, value);
+            return;
+        default:
+            throw py::attribute_error(std::format(
+                "attribute '{}' is not a property, and thus cannot be set", field.field->Name()));
     }
-
-    throw py::attribute_error("cannot set a null field");
 }
 
 }  // namespace pyunrealsdk::unreal
@@ -82,15 +82,81 @@ struct PyFieldVariant : public base_variant {
 };
 
 /**
- * @brief Searches for a field on a struct, throwing an attribute error if it doesn't exist.
+ * @brief The different kinds of field an attribute access may resolve to.
+ */
+enum class FieldKind : uint8_t {
+    MISSING,
+    PROPERTY,
+    FUNCTION,
+    SCRIPT_STRUCT,
+    CONST,
+    ENUM,
+    UNKNOWN,
+};
+
+/**
+ * @brief A field which has already been looked up, and had its kind worked out.
+ */
+struct ResolvedField {
+    FieldKind kind = FieldKind::MISSING;
+    // Set if the kind is a property
+    unrealsdk::unreal::ZProperty* prop = nullptr;
+    // Set for all other (non-missing) kinds
+    unrealsdk::unreal::UField* field = nullptr;
+};
+
+/**
+ * @brief Works out what kind of field a variant holds.
+ *
+ * @param field The field to resolve.
+ * @return The resolved field.
+ */
+ResolvedField resolve_field(const PyFieldVariant& field);
+
+/**
+ * @brief Searches for a field on a struct, using a cache of previous lookups.
+ * @note Both hits and misses are cached, so repeatedly looking up missing fields is cheap. Both
+ *       caches are bounded in size.
  *
  * @param name The field name.
  * @param type The type of the unreal object this access is reading off of.
- * @return The field. Invalid keys throw, so will never be null.
+ * @return The field. Has kind missing if it doesn't exist.
  */
-PyFieldVariant py_find_field(const unrealsdk::unreal::FName& name,
+ResolvedField try_find_field(const unrealsdk::unreal::FName& name,
                              const unrealsdk::unreal::UStruct* type);
 
+/**
+ * @brief Searches for a field on a struct, throwing an attribute error if it doesn't exist.
+ *
+ * @param name The field name.
+ * @param type The type of the unreal object this access is reading off of.
+ * @return The field. Invalid keys throw, so will never be missing.
+ */
+ResolvedField py_find_field(const unrealsdk::unreal::FName& name,
+                            const unrealsdk::unreal::UStruct* type);
+
+/**
+ * @brief Getter and setter functions, specialized to a single property type.
+ * @note Both are only valid to call with the property they were retrieved from.
+ */
+struct PropertyAccessors {
+    py::object (*get)(const unrealsdk::unreal::ZProperty* prop,
+                      uintptr_t base_addr,
+                      const unrealsdk::unreal::UnrealPointer<void>& parent);
+    void (*set)(const unrealsdk::unreal::ZProperty* prop,
+                uintptr_t base_addr,
+                const py::object& value);
+};
+
+/**
+ * @brief Gets the getter and setter functions for a property's concrete type.
+ * @note These behave the same as `py_getattr` and `py_setattr_direct`, but skip all type dispatch.
+ *
+ * @param prop The property to get the accessors of.
+ * @return The accessor functions.
+ */
+PropertyAccessors get_property_accessors(unrealsdk::unreal::ZProperty* prop);
+
 /**
  * @brief Implements `__dir__`.
  *
@@ -113,6 +179,10 @@ py::object py_getattr(PyFieldVariant field,
                       uintptr_t base_addr,
                       const unrealsdk::unreal::UnrealPointer<void>& parent,
                       unrealsdk::unreal::UObject* func_obj = nullptr);
+py::object py_getattr(const ResolvedField& field,
+                      uintptr_t base_addr,
+                      const unrealsdk::unreal::UnrealPointer<void>& parent,
+                      unrealsdk::unreal::UObject* func_obj = nullptr);
 
 /**
  * @brief Sets an unreal field to a python object directly.
@@ -126,6 +196,7 @@ py::object py_getattr(PyFieldVariant field,
  * @param value The value to set.
  */
 void py_setattr_direct(PyFieldVariant field, uintptr_t base_addr, const py::object& value);
+void py_setattr_direct(const ResolvedField& field, uintptr_t base_addr, const py::object& value);
 
 }  // namespace pyunrealsdk::unreal
 
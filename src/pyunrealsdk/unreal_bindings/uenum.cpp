@@ -25,8 +25,30 @@ void register_uenum(py::module_& mod) {
                                            "    An IntFlag enum compatible with this enum.\n"));
 }
 
-py::object enum_as_py_enum(const UEnum* enum_obj) {
-    const py::gil_scoped_acquire gil{};
+namespace {
+
+struct EnumCacheEntry {
+    StaticPyObject py_enum;
+    // Maps values directly to their members, including any pseudo-members we've created before
+    std::unordered_map<int64_t, StaticPyObject> members;
+};
+
+// Enums may get converted from any thread, but we only ever access this while holding the GIL.
+// Entries are never removed, so references to them remain valid even if python releases the GIL.
+std::unordered_map<const UEnum*, std::unique_ptr<EnumCacheEntry>> enum_cache{};
+
+/**
+ * @brief Gets the cache entry for an unreal enum, creating it if required.
+ * @note Requires the GIL.
+ *
+ * @param enum_obj The unreal enum object.
+ * @return The cache entry.
+ */
+EnumCacheEntry& get_enum_cache_entry(const UEnum* enum_obj) {
+    auto iter = enum_cache.find(enum_obj);
+    if (iter != enum_cache.end()) {
+        return *iter->second;
+    }
 
     // Use IntFlag, as it natively supports unknown values
     PYBIND11_CONSTINIT static py::gil_safe_call_once_and_store<py::object> storage;
@@ -35,16 +57,42 @@ py::object enum_as_py_enum(const UEnum* enum_obj) {
                             []() { return py::module_::import("enum").attr("IntFlag"); })
                         .get_stored();
 
-    static std::unordered_map<const UEnum*, StaticPyObject> enum_cache{};
+    auto entry = std::make_unique<EnumCacheEntry>();
+    auto py_enum = intflag(enum_obj->Name(), enum_obj->get_names());
+    py_enum.attr("_unreal") = enum_obj;
+
+    // `__members__` also includes aliases, but they map to the same member as the canonical name
+    for (auto member : py_enum.attr("__members__").attr("values")()) {
+        entry->members.emplace(py::cast<int64_t>(member),
+                               py::reinterpret_borrow<py::object>(member));
+    }
+    entry->py_enum = std::move(py_enum);
+
+    // Calling into python may have released the GIL, so if another thread beat us to creating the
+    // entry, use theirs instead
+    auto [new_iter, inserted] = enum_cache.try_emplace(enum_obj, std::move(entry));
+    return *new_iter->second;
+}
+
+}  // namespace
+
+py::object enum_as_py_enum(const UEnum* enum_obj) {
+    const py::gil_scoped_acquire gil{};
+    return get_enum_cache_entry(enum_obj).py_enum;
+}
 
-    if (!enum_cache.contains(enum_obj)) {
-        auto py_enum = intflag(enum_obj->Name(), enum_obj->get_names());
-        py_enum.attr("_unreal") = enum_obj;
+py::object enum_value_as_py(const UEnum* enum_obj, int64_t value) {
+    auto& entry = get_enum_cache_entry(enum_obj);
 
-        enum_cache.emplace(enum_obj, py_enum);
+    auto iter = entry.members.find(value);
+    if (iter != entry.members.end()) {
+        return iter->second;
     }
 
-    return enum_cache[enum_obj];
+    // Unknown value, let IntFlag create a pseudo-member, and remember it for next time
+    auto member = entry.py_enum(value);
+    entry.members.try_emplace(value, member);
+    return member;
 }
 
 PYUNREALSDK_CAPI(PyObject*, enum_as_py_enum, const UEnum* enum_obj) {
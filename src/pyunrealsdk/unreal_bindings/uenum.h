@@ -20,6 +20,17 @@ namespace pyunrealsdk::unreal {
  */
 void register_uenum(py::module_& mod);
 
+/**
+ * @brief Converts an unreal enum value into the matching python enum member.
+ * @note Uses a per-enum lookup table, rather than calling the python enum.
+ * @note Requires the GIL.
+ *
+ * @param enum_obj The unreal enum object.
+ * @param value The value to convert.
+ * @return The python enum member.
+ */
+py::object enum_value_as_py(const unrealsdk::unreal::UEnum* enum_obj, int64_t value);
+
 #endif
 
 /**
@@ -38,6 +38,10 @@ size_t should_notify_counter = 0;
 
 }  // namespace
 
+bool should_notify_changes(void) {
+    return should_notify_counter > 0;
+}
+
 void register_uobject(py::module_& mod) {
     PYUNREALSDK_STUBGEN_MODULE_N("unrealsdk.unreal")
 
@@ -152,11 +156,8 @@ void register_uobject(py::module_& mod) {
                 auto field = py_find_field(py::cast<FName>(name), self->Class());
                 py_setattr_direct(field, reinterpret_cast<uintptr_t>(self), value);
 
-                if (should_notify_counter > 0) {
-                    auto prop = field.as_prop();
-                    if (prop != nullptr) {
-                        self->post_edit_change_property(prop);
-                    }
+                if (should_notify_counter > 0 && field.kind == FieldKind::PROPERTY) {
+                    self->post_edit_change_property(field.prop);
                 }
             },
             PYUNREALSDK_STUBGEN_DOCSTRING("Writes a value to an unreal field on the object.\n"
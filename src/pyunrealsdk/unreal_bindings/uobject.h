@@ -14,6 +14,13 @@ namespace pyunrealsdk::unreal {
  */
 void register_uobject(py::module_& mod);
 
+/**
+ * @brief Checks if we're currently inside a `notify_changes` context.
+ *
+ * @return True if property sets should call `post_edit_change_property`.
+ */
+[[nodiscard]] bool should_notify_changes(void);
+
 }  // namespace pyunrealsdk::unreal
 
 #endif
@@ -2,6 +2,8 @@
 #include "pyunrealsdk/unreal_bindings/uobject_children.h"
 #include "pyunrealsdk/stubgen.h"
 #include "pyunrealsdk/unreal_bindings/bindings.h"
+#include "pyunrealsdk/unreal_bindings/bound_function.h"
+#include "pyunrealsdk/unreal_bindings/field_accessor.h"
 #include "unrealsdk/unreal/classes/ublueprintgeneratedclass.h"
 #include "unrealsdk/unreal/classes/uclass.h"
 #include "unrealsdk/unreal/classes/uconst.h"
@@ -152,7 +154,15 @@ void register_uobject_children(py::module_& mod) {
         .def_member_prop(PYUNREALSDK_STUBGEN_ATTR("Offset_Internal", "int"),
                          &ZProperty::Offset_Internal)
         .def_member_prop(PYUNREALSDK_STUBGEN_ATTR("PropertyLinkNext", "ZProperty | None"),
-                         &ZProperty::PropertyLinkNext);
+                         &ZProperty::PropertyLinkNext)
+        .def(
+            PYUNREALSDK_STUBGEN_METHOD("_accessor", "FieldAccessor"),
+            [](ZProperty* self) { return FieldAccessor{self}; },
+            PYUNREALSDK_STUBGEN_DOCSTRING(
+                "Creates an accessor object, to quickly get/set this property on objects.\n"
+                "\n"
+                "Returns:\n"
+                "    A new accessor for this property.\n"));
 
     PyUEClass<UStruct, UField>(mod, PYUNREALSDK_STUBGEN_CLASS("UStruct", "UField"))
         .def_member_prop(PYUNREALSDK_STUBGEN_ATTR("SuperField", "UStruct | None"),
@@ -253,7 +263,7 @@ void register_uobject_children(py::module_& mod) {
                                           "    name: The name of the child field.\n"
                                           "Returns:\n"
                                           "    The found child field.\n"),
-            PYUNREALSDK_STUBGEN_ARG("name"_a, "str", ))
+            PYUNREALSDK_STUBGEN_ARG("name"_a, "str | FName", ))
         .def(PYUNREALSDK_STUBGEN_METHOD("_find_prop", "ZProperty"), &UStruct::find_prop,
              PYUNREALSDK_STUBGEN_DOCSTRING(
                  "Finds a child property by name.\n"
@@ -266,7 +276,7 @@ void register_uobject_children(py::module_& mod) {
                  "    name: The name of the child property.\n"
                  "Returns:\n"
                  "    The found child property.\n"),
-             PYUNREALSDK_STUBGEN_ARG("name"_a, "str", ));
+             PYUNREALSDK_STUBGEN_ARG("name"_a, "str | FName", ));
 
     // ======== Third Layer Subclasses ========
 
@@ -335,7 +345,32 @@ void register_uobject_children(py::module_& mod) {
                  "Finds the return param for this function (if it exists).\n"
                  "\n"
                  "Returns:\n"
-                 "    The return param, or None if it doesn't exist.\n"));
+                 "    The return param, or None if it doesn't exist.\n"))
+        .def(PYUNREALSDK_STUBGEN_METHOD("call_many", "list[Any]"), &call_many,
+             PYUNREALSDK_STUBGEN_DOCSTRING(
+                 "Calls this function on many objects.\n"
+                 "\n"
+                 "This is equivalent to creating a BoundFunction for each object and calling it,\n"
+                 "except all args are converted first, and the GIL is only released once for\n"
+                 "the whole batch.\n"
+                 "\n"
+                 "If converting the args or calling the function fails for one object, the\n"
+                 "exception is stored in that object's index of the returned list, and the\n"
+                 "remaining objects are still called.\n"
+                 "\n"
+                 "Args:\n"
+                 "    objects: The objects to call this function on.\n"
+                 "    args: Either a WrappedStruct of this function's params, which will be used\n"
+                 "          for every call, or an iterable with an entry per object. Each entry\n"
+                 "          may be a WrappedStruct, a dict of kwargs, or a sequence of\n"
+                 "          positional args.\n"
+                 "Returns:\n"
+                 "    A list of the same values as calling the bound function would return, or of\n"
+                 "    the exception raised, for each object.\n"),
+             PYUNREALSDK_STUBGEN_ARG("objects"_a, "Sequence[UObject]", ),
+             PYUNREALSDK_STUBGEN_ARG("args"_a,
+                                     "WrappedStruct | Iterable[WrappedStruct | "
+                                     "Mapping[str, Any] | Sequence[Any]]", ));
 
     PyUEClass<ZGameDataHandleProperty, ZProperty>(
         mod, PYUNREALSDK_STUBGEN_CLASS("ZGameDataHandleProperty", "ZProperty"))
@@ -144,8 +144,12 @@ void register_wrapped_multicast_delegate(py::module_& mod) {
                 impl::PyCallInfo info{self.signature, args, kwargs};
 
                 // Release the GIL to avoid a deadlock if ProcessEvent is locking.
-                const py::gil_scoped_release gil{};
-                self.call(info.params);
+                // Only release it around the call itself, the call info must be destroyed while
+                // holding the GIL, since it may return it's params struct to the pool.
+                {
+                    const py::gil_scoped_release gil{};
+                    self.call(info.params);
+                }
             },
             PYUNREALSDK_STUBGEN_DOCSTRING(
                 "Calls all functions bound to this delegate.\n"